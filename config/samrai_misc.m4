@@ -19,5 +19,16 @@ AC_ARG_ENABLE([box_counting],
          AC_DEFINE(BOX_TELEMETRY,1,Enable Box counting)
       fi
    ],)
+
+AC_ARG_ENABLE([cxx_geom_kernels],
+[AS_HELP_STRING([--enable-cxx_geom_kernels],
+   [Use C++ kernels in place of FORTRAN in the Cartesian operators listed in geom/CartesianKernels.h.])],
+   [
+      if test "x$enableval" = "xyes"; then
+         AC_DEFINE(SAMRAI_GEOM_CXX_KERNELS,1,Use C++ Cartesian geometry kernels)
+      elif test "x$enableval" = "x"; then
+         AC_DEFINE(SAMRAI_GEOM_CXX_KERNELS,1,Use C++ Cartesian geometry kernels)
+      fi
+   ],)
 ]
 )
@@ -22,6 +22,7 @@
 #include "SAMRAI/hier/Variable.h"
 #include "SAMRAI/hier/VariableContext.h"
 #include "SAMRAI/mesh/GriddingAlgorithm.h"
+#include "SAMRAI/mesh/PatchCostModel.h"
 #include "SAMRAI/mesh/StandardTagAndInitStrategy.h"
 #include "SAMRAI/tbox/Database.h"
 #include "SAMRAI/tbox/Serializable.h"
@@ -102,6 +103,18 @@ namespace algs {
  *       indicates whether ghost data must be filled before timestep is
  *       computed on each patch (possible communication optimization)
  *
+ *    - \b    fuse_time_refine
+ *       indicates whether time dependent data filled from a coarser level
+ *       should use a fused time interpolation and refinement operator when
+ *       the transfer geometry provides one (see
+ *       hier::TransferOperatorRegistry::addTimeRefineOperator()).  The fused
+ *       operator reads the old and new coarse data directly instead of a
+ *       time interpolated coarse temporary.  That temporary is then left
+ *       unfilled, so fusion only takes place if the patch strategy's
+ *       xfer::RefinePatchStrategy::allowsFusedTimeRefine() returns true,
+ *       i.e., its pre/postprocessRefine() methods do not read coarse
+ *       scratch data.  Otherwise this flag has no effect.
+ *
  * Note that when continuing from restart, the input parameters in the input
  * database override all values read in from the restart database.
  *
@@ -147,6 +160,14 @@ namespace algs {
  *     <td>opt</td>
  *     <td>Parameter read from restart db may be overridden by input db</td>
  *   </tr>
+ *   <tr>
+ *     <td>fuse_time_refine</td>
+ *     <td>bool</td>
+ *     <td>FALSE</td>
+ *     <td>TRUE, FALSE</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart.  Value in input db used.</td>
+ *   </tr>
  * </table>
  *
  * A sample input file entry might look like:
@@ -742,6 +763,24 @@ public:
       return d_use_time_refinement;
    }
 
+   /*!
+    * @brief Set a model to be fed with the measured cost of the patch
+    * kernels.
+    *
+    * When set, the flux computation and conservative difference on each
+    * patch are timed, the model is updated after each (non-regrid)
+    * advance of a level, and the workload data of new levels is filled
+    * from the model.  Give the model's workload data id to the load
+    * balancer to partition by the measured cost.  A null pointer turns
+    * the measurements off.
+    */
+   void
+   setPatchCostModel(
+      const std::shared_ptr<mesh::PatchCostModel>& cost_model)
+   {
+      d_cost_model = cost_model;
+   }
+
    /*
     * Write out statistics recorded on numbers of cells and patches generated.
     */
@@ -1115,6 +1154,12 @@ private:
     */
    bool d_distinguish_mpi_reduction_costs;
 
+   /*
+    * Whether to register fused time interpolation and refinement operators
+    * with the boundary fill algorithms for time dependent data.
+    */
+   bool d_fuse_time_refine;
+
    static bool s_barrier_after_error_bdry_fill_comm;
 
    /*!
@@ -1122,6 +1167,11 @@ private:
     */
    bool d_barrier_advance_level_sections;
 
+   /*!
+    * @brief Optional model of the patch cost.  See setPatchCostModel().
+    */
+   std::shared_ptr<mesh::PatchCostModel> d_cost_model;
+
    /*
     * Timers interspersed throughout the class.
     */
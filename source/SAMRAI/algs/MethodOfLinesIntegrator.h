@@ -18,6 +18,7 @@
 #include "SAMRAI/hier/ComponentSelector.h"
 #include "SAMRAI/tbox/Database.h"
 #include "SAMRAI/mesh/GriddingAlgorithm.h"
+#include "SAMRAI/mesh/PatchCostModel.h"
 #include "SAMRAI/algs/MethodOfLinesPatchStrategy.h"
 #include "SAMRAI/hier/PatchHierarchy.h"
 #include "SAMRAI/hier/PatchLevel.h"
@@ -335,6 +336,19 @@ public:
    putToRestart(
       const std::shared_ptr<tbox::Database>& restart_db) const;
 
+   /*!
+    * Set a model to be fed with the measured cost of singleStep() on
+    * each patch.  The model is updated on every level after each
+    * advance, and the workload data of new levels is filled from it.
+    * A null pointer turns the measurements off.
+    */
+   void
+   setPatchCostModel(
+      const std::shared_ptr<mesh::PatchCostModel>& cost_model)
+   {
+      d_cost_model = cost_model;
+   }
+
    /*!
     * Returns the object name.
     */
@@ -470,6 +484,11 @@ private:
    hier::ComponentSelector d_scratch_data;
    hier::ComponentSelector d_rhs_data;
 
+   /*
+    * Optional model of the patch cost.
+    */
+   std::shared_ptr<mesh::PatchCostModel> d_cost_model;
+
 };
 
 }
@@ -28,12 +28,15 @@
 #include "SAMRAI/tbox/IOStream.h"
 #include "SAMRAI/tbox/Database.h"
 #include "SAMRAI/tbox/HDFDatabase.h"
+#include "SAMRAI/tbox/RestartManager.h"
 #include "SAMRAI/tbox/Timer.h"
 #include "SAMRAI/tbox/Database.h"
 #include "SAMRAI/tbox/SAMRAI_MPI.h"
 
 #include <string>
 #include <list>
+#include <map>
+#include <thread>
 #include <vector>
 #include <memory>
 
@@ -142,6 +145,10 @@ namespace appu {
  *    - If using species of the materials, register the names of
  *      the species of each material using the registerSpeciesNames() method.
  *
+ *    - Optionally, compress the plot data of all or some variables with
+ *      setCompression(), setPlotQuantityCompression() or
+ *      setCompressionFromInput().
+ *
  *    - The writer will generate VisIt dump files when the method
  *      writePlotData() is called.  Minimally, only a hierarchy and the
  *      time step number is needed.  A simulation time can also be
@@ -157,7 +164,8 @@ namespace appu {
  *
  */
 
-class VisItDataWriter
+class VisItDataWriter:
+   public tbox::RestartManager::BackgroundWriter
 {
 public:
    /*!
@@ -175,8 +183,9 @@ public:
     * number_procs_per_file is greater than the number of processors,
     * then all processors share a single vis dump file.  Reducing the
     * number of files written may reduce parallel I/O contention and
-    * thus improve I/O efficiency.  The optional argument is_multiblock
-    * defaults to false.  It must be set to true for problems on multiblock
+    * thus improve I/O efficiency.  Processors share dump files only when
+    * writing them collectively; see setUseCollectiveIO().  The optional
+    * argument is_multiblock defaults to false.  It must be set to true for problems on multiblock
     * domains, and left false in all other cases.
     *
     * Before the data writer object can be used for dumping VisIt
@@ -719,6 +728,157 @@ public:
       d_write_ghosts = write_ghosts; 
    }
 
+   /*!
+    * @brief Set whether the processors sharing a dump file write it
+    * collectively.
+    *
+    * In collective mode the processors of each file cluster (see the
+    * number_procs_per_file constructor argument) open their file together
+    * through parallel HDF5.  All groups and datasets of the cluster are
+    * created collectively, with storage preallocated for every patch,
+    * and each processor then writes its patches at the same time as the
+    * others instead of taking turns with the file.  The layout of the
+    * files is the same in both modes.
+    *
+    * Collective mode requires an HDF5 library with parallel support.  If
+    * it is not available a warning is printed and files are written one
+    * per processor.  Without collective mode, number_procs_per_file must
+    * be 1.
+    *
+    * @param use_collective_io  True to write dump files collectively
+    */
+   void
+   setUseCollectiveIO(
+      bool use_collective_io)
+   {
+      d_use_collective_io = use_collective_io;
+   }
+
+   /*!
+    * @brief Set the compression of the patch data of all plot quantities
+    * without a compression of their own.
+    *
+    * Plot data is written as float arrays, compressed with the deflate
+    * filter if deflate_level is positive (see
+    * tbox::HDFDatabase::setCompression()).  Before that the float mantissas
+    * may be rounded to fewer bits, which is lossy but makes the data
+    * compress much better; plot data rarely needs full float precision.
+    * Compression is not used when writing collectively.
+    *
+    * The numbers of bytes of each variable written and stored in the dump
+    * files are saved in the summary file as "var_raw_bytes" and
+    * "var_stored_bytes", in the order of "var_names".
+    *
+    * @param deflate_level  Deflate level from 1 to 9, or 0 for none
+    * @param shuffle        Whether to shuffle bytes before deflating
+    * @param mantissa_bits  Number of float mantissa bits kept, up to 23
+    *
+    * @pre (deflate_level >= 0) && (deflate_level <= 9)
+    * @pre (mantissa_bits >= 1) && (mantissa_bits <= 23)
+    */
+   void
+   setCompression(
+      int deflate_level,
+      bool shuffle = true,
+      int mantissa_bits = 23);
+
+   /*!
+    * @brief Set the compression of the patch data of one plot quantity.
+    *
+    * The variable need not be registered yet.  For vector and tensor
+    * quantities the setting applies to all components.
+    *
+    * @param variable_name  Name of the plot quantity
+    * @param deflate_level  Deflate level from 1 to 9, or 0 for none
+    * @param shuffle        Whether to shuffle bytes before deflating
+    * @param mantissa_bits  Number of float mantissa bits kept, up to 23
+    *
+    * @pre !variable_name.empty()
+    * @pre (deflate_level >= 0) && (deflate_level <= 9)
+    * @pre (mantissa_bits >= 1) && (mantissa_bits <= 23)
+    *
+    * @see setCompression()
+    */
+   void
+   setPlotQuantityCompression(
+      const std::string& variable_name,
+      int deflate_level,
+      bool shuffle = true,
+      int mantissa_bits = 23);
+
+   /*!
+    * @brief Set the compression of plot data from an input database.
+    *
+    * The optional keys deflate_level, shuffle and mantissa_bits set the
+    * compression of all plot quantities (see setCompression()).  Each
+    * sub-database sets the compression of the plot quantity it is named
+    * after, with the same keys; keys it lacks take the values given for
+    * all quantities.  For example
+    *
+    * @code
+    *    deflate_level = 4
+    *    Pressure {
+    *       mantissa_bits = 12
+    *    }
+    * @endcode
+    *
+    * @param input_db  Input database, which may be null
+    */
+   void
+   setCompressionFromInput(
+      const std::shared_ptr<tbox::Database>& input_db);
+
+   /*!
+    * @brief Set whether dump files are written in the background.
+    *
+    * In staged mode writePlotData() packs the plot data of this processor
+    * into a staging buffer in memory and writes the summary file, which
+    * involves all processors, before returning.  The processor's dump
+    * file is then written from the staging buffer by a background
+    * thread while the application continues, e.g. with its next time
+    * steps.  The plot data is copied when it is packed, so the
+    * application may change or regrid its data right away.
+    *
+    * Only one dump is staged at a time: writePlotData() waits for the
+    * previous dump to be written before packing the next one, as does
+    * the destructor.  The writer registers with the tbox::RestartManager,
+    * which waits for the dump before writing a restart file.  The
+    * application must call waitForPlotData() before doing any other HDF5
+    * I/O of its own.  Staged mode does not apply when writing
+    * collectively (see setUseCollectiveIO()).
+    *
+    * The background thread needs a thread-safe HDF5 library.  If the
+    * library is not thread-safe, a warning is printed and dump files are
+    * written synchronously.
+    *
+    * When staging, the stored bytes of each variable recorded in the
+    * summary file (see setCompression()) are its uncompressed bytes.
+    *
+    * @param use_staged_io  True to write dump files in the background
+    */
+   void
+   setUseStagedIO(
+      bool use_staged_io);
+
+   /*!
+    * @brief Wait until the dump file staged by the last call to
+    * writePlotData() has been written.
+    *
+    * Returns immediately if there is no staged dump being written.  An
+    * error in writing the staged dump is reported here, on the calling
+    * thread.
+    */
+   void
+   waitForPlotData();
+
+   /*!
+    * @brief Wait for the staged dump file, as waitForPlotData().
+    *
+    * Called by the tbox::RestartManager before writing a restart file.
+    */
+   void
+   waitForBackgroundWrites();
+
 private:
    /*
     * Static integer constant describing version of VisIt Data Writer.
@@ -881,6 +1041,8 @@ private:
     *   d_coord_scale_factor - scale factor of the different deformed coords
     *   d_level_start_depth_index - int array specifying start depth on
     *                               each level
+    *   d_raw_bytes, d_stored_bytes - bytes of patch data written in the
+    *       current dump before compression and as stored
     *
     * Material information
     *   d_isa_material - boolean specifying if variable is a material
@@ -927,6 +1089,8 @@ private:
       d_master_min_max[VISIT_MAX_NUMBER_COMPONENTS];
       std::vector<int> d_level_patch_data_index;
       std::vector<double> d_coord_scale_factor;
+      double d_raw_bytes;
+      double d_stored_bytes;
 
       /*
        * Material information
@@ -975,6 +1139,16 @@ private:
       int start_depth_index,
       std::string method_name);
 
+   /*
+    * Write the HDF plot file of this processor's file cluster collectively
+    * with the other processors of the cluster.
+    */
+   void
+   writeHDFFileCollectively(
+      const std::string& visit_HDFFilename,
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      double simulation_time);
+
    /*
     * Coordinate writing HDF plot files, both data and summary.
     */
@@ -1014,6 +1188,84 @@ private:
       hier::Patch& patch,
       double simulation_time);
 
+   /*
+    * Compression of the patch data of a plot quantity; see
+    * setCompression().
+    */
+   struct PlotCompression {
+      int d_deflate_level;
+      bool d_shuffle;
+      int d_mantissa_bits;
+   };
+
+   /*
+    * Return the compression of the named plot quantity.
+    */
+   const PlotCompression&
+   getPlotCompression(
+      const std::string& variable_name) const;
+
+   /*
+    * Write a float array of plot data with the compression of the plot
+    * item, adding its bytes to those of the item.  The mantissas in
+    * the buffer are rounded in place.
+    */
+   void
+   putFloatPlotArray(
+      const std::shared_ptr<tbox::Database>& HDFGroup,
+      const std::string& name,
+      float* fbuffer,
+      const int buf_size,
+      VisItItem& plotitem);
+
+   /*
+    * Pack the plot data of this processor into a staging database, to be
+    * written to the HDF plot file of this processor by
+    * startStagedHDFFileWrite().
+    */
+   void
+   stageHDFFile(
+      const std::string& visit_HDFFilename,
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      double simulation_time);
+
+   /*
+    * Start the background thread writing the staged HDF plot file.
+    */
+   void
+   startStagedHDFFileWrite();
+
+   /*
+    * Write a staged processor database to a new HDF plot file, compressing
+    * float arrays with the compression given for their key.  Runs on the
+    * background thread, so it uses none of the writer's members, and
+    * returns errors in error_message instead of aborting.
+    */
+   static void
+   writeStagedHDFFile(
+      const std::string& visit_HDFFilename,
+      const std::shared_ptr<tbox::Database>& staged_database,
+      const std::map<std::string, PlotCompression>& compression,
+      std::string* error_message);
+
+   /*
+    * Copy the entries of a staged database to an HDF database.  Returns
+    * false, with a message in error_message, on an entry of a type that
+    * is not supported.
+    */
+   static bool
+   copyStagedDatabase(
+      tbox::Database& staged_database,
+      tbox::HDFDatabase& HDFGroup,
+      const std::map<std::string, PlotCompression>& compression,
+      std::string& error_message);
+
+   /*
+    * Whether the HDF5 library may be called from more than one thread.
+    */
+   static bool
+   isHDFLibraryThreadSafe();
+
    /*
     * Pack the materials data into the supplied database for output.
     */
@@ -1097,8 +1349,8 @@ private:
 
    /*
     * Helper method for writeSummaryToHDFFile() method above.
-    * Performs tbox::MPI communications to send min/max information for all
-    * variables on all patches to the VISIT_MASTER.
+    * Gathers the min/max information for all variables on all patches
+    * on the VISIT_MASTER with a single collective operation.
     */
    void
    exchangeMinMaxPatchInformation(
@@ -1337,6 +1589,29 @@ private:
     */
    bool d_write_ghosts;
 
+   /*
+    * Boolean to select collective writing of files shared by processors
+    */
+   bool d_use_collective_io;
+
+   /*
+    * Compression of plot quantities without a compression of their own,
+    * and of those with one, by variable name.
+    */
+   PlotCompression d_default_compression;
+   std::map<std::string, PlotCompression> d_quantity_compression;
+
+   /*
+    * Staged writing of dump files: the flag selecting it, the dump
+    * waiting to be written, the thread writing the previous one and the
+    * error that thread reports, if any.
+    */
+   bool d_use_staged_io;
+   std::string d_staged_HDFFilename;
+   std::shared_ptr<tbox::Database> d_staged_database;
+   std::thread d_staged_write_thread;
+   std::string d_staged_write_error;
+
    /*
     * brief Storage for strings defining VisIt expressions to be embedded in
     * the plot dump.
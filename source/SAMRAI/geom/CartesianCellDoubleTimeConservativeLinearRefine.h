@@ -0,0 +1,114 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2018 Lawrence Livermore National Security, LLC
+ * Description:   Linear time interpolation fused with conservative linear
+ *                refinement for cell-centered double data on a Cartesian
+ *                mesh.
+ *
+ ************************************************************************/
+
+#ifndef included_geom_CartesianCellDoubleTimeConservativeLinearRefine
+#define included_geom_CartesianCellDoubleTimeConservativeLinearRefine
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/TimeRefineOperator.h"
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/hier/Patch.h"
+
+#include <string>
+#include <memory>
+
+namespace SAMRAI {
+namespace geom {
+
+/**
+ * Class CartesianCellDoubleTimeConservativeLinearRefine fuses standard
+ * linear time interpolation with conservative linear interpolation for
+ * cell-centered double patch data defined over a Cartesian mesh.  It
+ * produces the same fine data as pdat::CellDoubleLinearTimeInterpolateOp
+ * followed by CartesianCellDoubleConservativeLinearRefine, but reads the old
+ * and new coarse data directly instead of a time interpolated coarse
+ * temporary.  It is derived from the base class hier::TimeRefineOperator.
+ * The numerical operations use FORTRAN numerical routines.
+ *
+ * @see hier::TimeRefineOperator
+ * @see CartesianCellDoubleConservativeLinearRefine
+ */
+
+class CartesianCellDoubleTimeConservativeLinearRefine:
+   public hier::TimeRefineOperator
+{
+public:
+   /**
+    * Uninteresting default constructor.
+    */
+   CartesianCellDoubleTimeConservativeLinearRefine();
+
+   /**
+    * Uninteresting virtual destructor.
+    */
+   virtual ~CartesianCellDoubleTimeConservativeLinearRefine();
+
+   /**
+    * The stencil width of the conservative linear interpolation operator is
+    * the vector of ones.
+    */
+   hier::IntVector
+   getStencilWidth(
+      const tbox::Dimension& dim) const;
+
+   /**
+    * Time interpolate the old and new source components on the coarse patch
+    * to fill_time and refine the result to the destination component on the
+    * fine patch using the cell-centered double conservative linear
+    * interpolation operator.  Interpolation is performed on the intersection
+    * of the destination patch and the boxes contained in fine_overlap.
+    *
+    * @pre dynamic_cast<const pdat::CellOverlap *>(&fine_overlap) != 0
+    */
+   void
+   refine(
+      hier::Patch& fine,
+      const hier::Patch& coarse,
+      const int dst_component,
+      const int src_told_component,
+      const int src_tnew_component,
+      const double fill_time,
+      const hier::BoxOverlap& fine_overlap,
+      const hier::IntVector& ratio) const;
+
+   /**
+    * Time interpolate and refine as above on the intersection of the
+    * destination patch and the fine box.
+    *
+    * @pre (fine.getDim() == coarse.getDim()) &&
+    *      (fine.getDim() == fine_box.getDim()) &&
+    *      (fine.getDim() == ratio.getDim())
+    * @pre coarse.getPatchData(src_told_component) and
+    *      coarse.getPatchData(src_tnew_component) are actually
+    *      std::shared_ptr<pdat::CellData<double> >
+    * @pre fine.getPatchData(dst_component) is actually a std::shared_ptr<pdat::CellData<double> >
+    * @pre (fine.getDim().getValue() == 1) ||
+    *      (fine.getDim().getValue() == 2) || (fine.getDim().getValue() == 3)
+    */
+   void
+   refine(
+      hier::Patch& fine,
+      const hier::Patch& coarse,
+      const int dst_component,
+      const int src_told_component,
+      const int src_tnew_component,
+      const double fill_time,
+      const hier::Box& fine_box,
+      const hier::IntVector& ratio) const;
+
+};
+
+}
+}
+#endif
@@ -0,0 +1,432 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2018 Lawrence Livermore National Security, LLC
+ * Description:   Templated C++ kernels for Cartesian refine and coarsen
+ *                operators.
+ *
+ ************************************************************************/
+
+#ifndef included_geom_CartesianKernels
+#define included_geom_CartesianKernels
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/tbox/Utilities.h"
+
+/*
+ * Vectorize the innermost loop of a kernel.  The loops carry no
+ * reductions, so the vectorized and scalar loops give identical results.
+ */
+#if defined(_OPENMP) && (_OPENMP >= 201307)
+#define SAMRAI_GEOM_KERNEL_SIMD _Pragma("omp simd")
+#else
+#define SAMRAI_GEOM_KERNEL_SIMD
+#endif
+
+namespace SAMRAI {
+namespace geom {
+
+/*!
+ * @brief Centering tag selecting the cell-centered kernels of
+ * CartesianKernels.
+ */
+struct CartesianCellCentering {};
+
+/*!
+ * @brief Centering tag selecting the side-centered kernels of
+ * CartesianKernels for the sides normal to direction AXIS.
+ */
+template<int AXIS>
+struct CartesianSideCentering {};
+
+/*!
+ * @brief Class CartesianKernels provides C++ versions of some of the
+ * numerical kernels behind the Cartesian refine and coarsen operators.
+ *
+ * Only three operators have C++ kernels: conservative linear refinement
+ * of cell-centered doubles, and weighted averaging of cell-centered and
+ * side-centered doubles, in one to three dimensions.  All other Cartesian
+ * operators, including node linear refinement and the face, edge and
+ * outer data operators, always use the FORTRAN routines.
+ *
+ * The kernels are templated on the dimension, on the data centering (one
+ * of the centering tags above) and on the refinement ratio.  A RATIO of
+ * zero means that the ratio is read from the ratio argument at run time;
+ * a positive RATIO requires every component of the ratio argument to
+ * equal RATIO and lets the compiler specialize the index arithmetic.
+ *
+ * The arguments follow the FORTRAN routines in geom/fortran: arrays are
+ * stored in column-major order over the given ghost boxes, and each
+ * kernel handles one depth component.  The kernels perform the same
+ * floating point operations in the same order as the FORTRAN routines,
+ * so the two give bitwise identical results.  The innermost loop runs
+ * over coarse indices along direction 0 and is marked for vectorization
+ * when OpenMP SIMD support is available.
+ *
+ * CartesianDoubleKernels selects the instantiation matching a run time
+ * dimension and ratio.
+ *
+ * @see CartesianCellDoubleConservativeLinearRefine
+ * @see CartesianCellDoubleWeightedAverage
+ * @see CartesianSideDoubleWeightedAverage
+ */
+template<int DIM, class CENTERING, int RATIO = 0>
+class CartesianKernels;
+
+/*!
+ * @brief Cell-centered kernels.
+ */
+template<int DIM, int RATIO>
+class CartesianKernels<DIM, CartesianCellCentering, RATIO>
+{
+public:
+   /*!
+    * @brief Conservative linear interpolation of cell-centered double data,
+    * as in the FORTRAN cartclinrefcelldoub routines.
+    *
+    * @param[in] coarse_box  Coarse cells under fine_box
+    * @param[in] fine_box  Fine cells to fill
+    * @param[in] coarse_ghost_box  Index space of arrayc
+    * @param[in] fine_ghost_box  Index space of arrayf
+    * @param[in] ratio
+    * @param[in] dxc  Coarse mesh spacing
+    * @param[in] dxf  Fine mesh spacing
+    * @param[in] arrayc  Coarse data, valid on coarse_box grown by one
+    * @param[out] arrayf  Fine data
+    */
+   static void
+   conservativeLinearRefine(
+      const hier::Box& coarse_box,
+      const hier::Box& fine_box,
+      const hier::Box& coarse_ghost_box,
+      const hier::Box& fine_ghost_box,
+      const hier::IntVector& ratio,
+      const double* dxc,
+      const double* dxf,
+      const double* arrayc,
+      double* arrayf);
+
+   /*!
+    * @brief Volume weighted averaging of cell-centered double data, as in
+    * the FORTRAN cartwgtavgcelldoub routines.
+    *
+    * @param[in] coarse_box  Coarse cells to fill
+    * @param[in] fine_ghost_box  Index space of arrayf
+    * @param[in] coarse_ghost_box  Index space of arrayc
+    * @param[in] ratio
+    * @param[in] dxf  Fine mesh spacing
+    * @param[in] dxc  Coarse mesh spacing
+    * @param[in] arrayf  Fine data
+    * @param[out] arrayc  Coarse data
+    */
+   static void
+   weightedAverage(
+      const hier::Box& coarse_box,
+      const hier::Box& fine_ghost_box,
+      const hier::Box& coarse_ghost_box,
+      const hier::IntVector& ratio,
+      const double* dxf,
+      const double* dxc,
+      const double* arrayf,
+      double* arrayc);
+};
+
+/*!
+ * @brief Side-centered kernels for the sides normal to direction AXIS.
+ */
+template<int DIM, int AXIS, int RATIO>
+class CartesianKernels<DIM, CartesianSideCentering<AXIS>, RATIO>
+{
+public:
+   /*!
+    * @brief Area weighted averaging of side-centered double data, as in the
+    * FORTRAN cartwgtavgsidedoub routines.
+    *
+    * The boxes are cell-centered; the side arrays extend one index further
+    * in direction AXIS.
+    *
+    * @param[in] coarse_box  Coarse cells whose sides are filled
+    * @param[in] fine_ghost_box  Cell index space of arrayf
+    * @param[in] coarse_ghost_box  Cell index space of arrayc
+    * @param[in] ratio
+    * @param[in] dxf  Fine mesh spacing
+    * @param[in] dxc  Coarse mesh spacing
+    * @param[in] arrayf  Fine data for direction AXIS
+    * @param[out] arrayc  Coarse data for direction AXIS
+    */
+   static void
+   weightedAverage(
+      const hier::Box& coarse_box,
+      const hier::Box& fine_ghost_box,
+      const hier::Box& coarse_ghost_box,
+      const hier::IntVector& ratio,
+      const double* dxf,
+      const double* dxc,
+      const double* arrayf,
+      double* arrayc);
+};
+
+/*!
+ * @brief Class CartesianDoubleKernels maps a run time dimension, ratio and
+ * side direction onto the matching CartesianKernels instantiation.
+ *
+ * Ratios of 2 and 4 in every direction use kernels specialized on the
+ * ratio; other ratios use the run time ratio kernels.  Only dimensions one
+ * through three are supported.
+ */
+class CartesianDoubleKernels
+{
+public:
+   /*!
+    * @brief See CartesianKernels::conservativeLinearRefine().
+    *
+    * @pre (coarse_box.getDim().getValue() >= 1) &&
+    *      (coarse_box.getDim().getValue() <= 3)
+    */
+   static void
+   cellConservativeLinearRefine(
+      const hier::Box& coarse_box,
+      const hier::Box& fine_box,
+      const hier::Box& coarse_ghost_box,
+      const hier::Box& fine_ghost_box,
+      const hier::IntVector& ratio,
+      const double* dxc,
+      const double* dxf,
+      const double* arrayc,
+      double* arrayf)
+   {
+      const int ratio_value = uniformRatio(ratio);
+      switch (coarse_box.getDim().getValue() * 10 + ratio_value) {
+         case 12:
+            CartesianKernels<1, CartesianCellCentering, 2>::
+            conservativeLinearRefine(coarse_box, fine_box, coarse_ghost_box,
+               fine_ghost_box, ratio, dxc, dxf, arrayc, arrayf);
+            break;
+         case 14:
+            CartesianKernels<1, CartesianCellCentering, 4>::
+            conservativeLinearRefine(coarse_box, fine_box, coarse_ghost_box,
+               fine_ghost_box, ratio, dxc, dxf, arrayc, arrayf);
+            break;
+         case 10:
+            CartesianKernels<1, CartesianCellCentering, 0>::
+            conservativeLinearRefine(coarse_box, fine_box, coarse_ghost_box,
+               fine_ghost_box, ratio, dxc, dxf, arrayc, arrayf);
+            break;
+         case 22:
+            CartesianKernels<2, CartesianCellCentering, 2>::
+            conservativeLinearRefine(coarse_box, fine_box, coarse_ghost_box,
+               fine_ghost_box, ratio, dxc, dxf, arrayc, arrayf);
+            break;
+         case 24:
+            CartesianKernels<2, CartesianCellCentering, 4>::
+            conservativeLinearRefine(coarse_box, fine_box, coarse_ghost_box,
+               fine_ghost_box, ratio, dxc, dxf, arrayc, arrayf);
+            break;
+         case 20:
+            CartesianKernels<2, CartesianCellCentering, 0>::
+            conservativeLinearRefine(coarse_box, fine_box, coarse_ghost_box,
+               fine_ghost_box, ratio, dxc, dxf, arrayc, arrayf);
+            break;
+         case 32:
+            CartesianKernels<3, CartesianCellCentering, 2>::
+            conservativeLinearRefine(coarse_box, fine_box, coarse_ghost_box,
+               fine_ghost_box, ratio, dxc, dxf, arrayc, arrayf);
+            break;
+         case 34:
+            CartesianKernels<3, CartesianCellCentering, 4>::
+            conservativeLinearRefine(coarse_box, fine_box, coarse_ghost_box,
+               fine_ghost_box, ratio, dxc, dxf, arrayc, arrayf);
+            break;
+         case 30:
+            CartesianKernels<3, CartesianCellCentering, 0>::
+            conservativeLinearRefine(coarse_box, fine_box, coarse_ghost_box,
+               fine_ghost_box, ratio, dxc, dxf, arrayc, arrayf);
+            break;
+         default:
+            TBOX_ERROR("CartesianDoubleKernels::cellConservativeLinearRefine"
+               << " error...\n dim > 3 not supported." << std::endl);
+      }
+   }
+
+   /*!
+    * @brief See CartesianKernels::weightedAverage() for cell-centered data.
+    *
+    * @pre (coarse_box.getDim().getValue() >= 1) &&
+    *      (coarse_box.getDim().getValue() <= 3)
+    */
+   static void
+   cellWeightedAverage(
+      const hier::Box& coarse_box,
+      const hier::Box& fine_ghost_box,
+      const hier::Box& coarse_ghost_box,
+      const hier::IntVector& ratio,
+      const double* dxf,
+      const double* dxc,
+      const double* arrayf,
+      double* arrayc)
+   {
+      const int ratio_value = uniformRatio(ratio);
+      switch (coarse_box.getDim().getValue() * 10 + ratio_value) {
+         case 12:
+            CartesianKernels<1, CartesianCellCentering, 2>::weightedAverage(
+               coarse_box, fine_ghost_box, coarse_ghost_box, ratio,
+               dxf, dxc, arrayf, arrayc);
+            break;
+         case 14:
+            CartesianKernels<1, CartesianCellCentering, 4>::weightedAverage(
+               coarse_box, fine_ghost_box, coarse_ghost_box, ratio,
+               dxf, dxc, arrayf, arrayc);
+            break;
+         case 10:
+            CartesianKernels<1, CartesianCellCentering, 0>::weightedAverage(
+               coarse_box, fine_ghost_box, coarse_ghost_box, ratio,
+               dxf, dxc, arrayf, arrayc);
+            break;
+         case 22:
+            CartesianKernels<2, CartesianCellCentering, 2>::weightedAverage(
+               coarse_box, fine_ghost_box, coarse_ghost_box, ratio,
+               dxf, dxc, arrayf, arrayc);
+            break;
+         case 24:
+            CartesianKernels<2, CartesianCellCentering, 4>::weightedAverage(
+               coarse_box, fine_ghost_box, coarse_ghost_box, ratio,
+               dxf, dxc, arrayf, arrayc);
+            break;
+         case 20:
+            CartesianKernels<2, CartesianCellCentering, 0>::weightedAverage(
+               coarse_box, fine_ghost_box, coarse_ghost_box, ratio,
+               dxf, dxc, arrayf, arrayc);
+            break;
+         case 32:
+            CartesianKernels<3, CartesianCellCentering, 2>::weightedAverage(
+               coarse_box, fine_ghost_box, coarse_ghost_box, ratio,
+               dxf, dxc, arrayf, arrayc);
+            break;
+         case 34:
+            CartesianKernels<3, CartesianCellCentering, 4>::weightedAverage(
+               coarse_box, fine_ghost_box, coarse_ghost_box, ratio,
+               dxf, dxc, arrayf, arrayc);
+            break;
+         case 30:
+            CartesianKernels<3, CartesianCellCentering, 0>::weightedAverage(
+               coarse_box, fine_ghost_box, coarse_ghost_box, ratio,
+               dxf, dxc, arrayf, arrayc);
+            break;
+         default:
+            TBOX_ERROR("CartesianDoubleKernels::cellWeightedAverage error...\n"
+               << "dim > 3 not supported." << std::endl);
+      }
+   }
+
+   /*!
+    * @brief See CartesianKernels::weightedAverage() for side-centered data.
+    *
+    * @pre (coarse_box.getDim().getValue() >= 1) &&
+    *      (coarse_box.getDim().getValue() <= 3)
+    * @pre (axis >= 0) && (axis < coarse_box.getDim().getValue())
+    */
+   static void
+   sideWeightedAverage(
+      const int axis,
+      const hier::Box& coarse_box,
+      const hier::Box& fine_ghost_box,
+      const hier::Box& coarse_ghost_box,
+      const hier::IntVector& ratio,
+      const double* dxf,
+      const double* dxc,
+      const double* arrayf,
+      double* arrayc)
+   {
+      const int dim = coarse_box.getDim().getValue();
+      TBOX_ASSERT(axis >= 0 && axis < dim);
+      if (dim == 1) {
+         sideWeightedAverage<1, 0>(coarse_box, fine_ghost_box,
+            coarse_ghost_box, ratio, dxf, dxc, arrayf, arrayc);
+      } else if (dim == 2) {
+         if (axis == 0) {
+            sideWeightedAverage<2, 0>(coarse_box, fine_ghost_box,
+               coarse_ghost_box, ratio, dxf, dxc, arrayf, arrayc);
+         } else {
+            sideWeightedAverage<2, 1>(coarse_box, fine_ghost_box,
+               coarse_ghost_box, ratio, dxf, dxc, arrayf, arrayc);
+         }
+      } else if (dim == 3) {
+         if (axis == 0) {
+            sideWeightedAverage<3, 0>(coarse_box, fine_ghost_box,
+               coarse_ghost_box, ratio, dxf, dxc, arrayf, arrayc);
+         } else if (axis == 1) {
+            sideWeightedAverage<3, 1>(coarse_box, fine_ghost_box,
+               coarse_ghost_box, ratio, dxf, dxc, arrayf, arrayc);
+         } else {
+            sideWeightedAverage<3, 2>(coarse_box, fine_ghost_box,
+               coarse_ghost_box, ratio, dxf, dxc, arrayf, arrayc);
+         }
+      } else {
+         TBOX_ERROR("CartesianDoubleKernels::sideWeightedAverage error...\n"
+            << "dim > 3 not supported." << std::endl);
+      }
+   }
+
+private:
+   /*
+    * Return 2 or 4 if every component of ratio has that value, else 0.
+    */
+   static int
+   uniformRatio(
+      const hier::IntVector& ratio)
+   {
+      const int r = ratio(0);
+      if (r != 2 && r != 4) {
+         return 0;
+      }
+      for (tbox::Dimension::dir_t d = 1; d < ratio.getDim().getValue(); ++d) {
+         if (ratio(d) != r) {
+            return 0;
+         }
+      }
+      return r;
+   }
+
+   template<int DIM, int AXIS>
+   static void
+   sideWeightedAverage(
+      const hier::Box& coarse_box,
+      const hier::Box& fine_ghost_box,
+      const hier::Box& coarse_ghost_box,
+      const hier::IntVector& ratio,
+      const double* dxf,
+      const double* dxc,
+      const double* arrayf,
+      double* arrayc)
+   {
+      switch (uniformRatio(ratio)) {
+         case 2:
+            CartesianKernels<DIM, CartesianSideCentering<AXIS>, 2>::
+            weightedAverage(coarse_box, fine_ghost_box, coarse_ghost_box,
+               ratio, dxf, dxc, arrayf, arrayc);
+            break;
+         case 4:
+            CartesianKernels<DIM, CartesianSideCentering<AXIS>, 4>::
+            weightedAverage(coarse_box, fine_ghost_box, coarse_ghost_box,
+               ratio, dxf, dxc, arrayf, arrayc);
+            break;
+         default:
+            CartesianKernels<DIM, CartesianSideCentering<AXIS>, 0>::
+            weightedAverage(coarse_box, fine_ghost_box, coarse_ghost_box,
+               ratio, dxf, dxc, arrayf, arrayc);
+      }
+   }
+
+};
+
+}
+}
+
+#include "SAMRAI/geom/CartesianKernels.C"
+
+#endif
@@ -0,0 +1,89 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2018 Lawrence Livermore National Security, LLC
+ * Description:   Linear time interpolation fused with conservative linear
+ *                refinement for side-centered double data on a Cartesian
+ *                mesh.
+ *
+ ************************************************************************/
+
+#ifndef included_geom_CartesianSideDoubleTimeConservativeLinearRefine
+#define included_geom_CartesianSideDoubleTimeConservativeLinearRefine
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/TimeRefineOperator.h"
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/hier/Patch.h"
+
+#include <string>
+#include <memory>
+
+namespace SAMRAI {
+namespace geom {
+
+/**
+ * Class CartesianSideDoubleTimeConservativeLinearRefine fuses standard
+ * linear time interpolation with conservative linear interpolation for
+ * side-centered double patch data defined over a Cartesian mesh.  It
+ * produces the same fine data as pdat::SideDoubleLinearTimeInterpolateOp
+ * followed by CartesianSideDoubleConservativeLinearRefine, but reads the old
+ * and new coarse data directly instead of a time interpolated coarse
+ * temporary.  It is derived from the base class hier::TimeRefineOperator.
+ * The numerical operations use FORTRAN numerical routines.
+ *
+ * @see hier::TimeRefineOperator
+ * @see CartesianSideDoubleConservativeLinearRefine
+ */
+
+class CartesianSideDoubleTimeConservativeLinearRefine:
+   public hier::TimeRefineOperator
+{
+public:
+   /**
+    * Uninteresting default constructor.
+    */
+   CartesianSideDoubleTimeConservativeLinearRefine();
+
+   /**
+    * Uninteresting virtual destructor.
+    */
+   virtual ~CartesianSideDoubleTimeConservativeLinearRefine();
+
+   /**
+    * The stencil width of the conservative linear interpolation operator is
+    * the vector of ones.
+    */
+   hier::IntVector
+   getStencilWidth(
+      const tbox::Dimension& dim) const;
+
+   /**
+    * Time interpolate the old and new source components on the coarse patch
+    * to fill_time and refine the result to the destination component on the
+    * fine patch using the side-centered double conservative linear
+    * interpolation operator.  Interpolation is performed on the intersection
+    * of the destination patch and the boxes contained in fine_overlap.
+    *
+    * @pre dynamic_cast<const pdat::SideOverlap *>(&fine_overlap) != 0
+    */
+   void
+   refine(
+      hier::Patch& fine,
+      const hier::Patch& coarse,
+      const int dst_component,
+      const int src_told_component,
+      const int src_tnew_component,
+      const double fill_time,
+      const hier::BoxOverlap& fine_overlap,
+      const hier::IntVector& ratio) const;
+
+};
+
+}
+}
+#endif
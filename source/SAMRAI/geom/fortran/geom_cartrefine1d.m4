@@ -148,3 +148,27 @@ c
 c      subroutine cartclinrefsidecplx1d(
 ccart_clinref_op_side_1d(`double complex')dnl
 c
+c***********************************************************************
+c Linear time interpolation fused with conservative linear
+c interpolation for 1d cell-centered double data
+c***********************************************************************
+c
+      subroutine cartlintimeclinrefcelldoub1d(
+cart_lintime_clinref_op_cell_1d(`double precision')dnl
+c
+c***********************************************************************
+c Linear time interpolation fused with conservative linear
+c interpolation for 1d side-centered double data
+c***********************************************************************
+c
+      subroutine cartlintimeclinrefsidedoub1d(
+cart_lintime_clinref_op_side_1d(`double precision')dnl
+c
+c***********************************************************************
+c Linear time interpolation fused with linear interpolation for 1d
+c node-centered double data
+c***********************************************************************
+c
+      subroutine cartlintimelinrefnodedoub1d(
+cart_lintime_linref_op_node_1d(`double precision')dnl
+c
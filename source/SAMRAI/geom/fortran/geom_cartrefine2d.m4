@@ -181,3 +181,30 @@ cc
 c      subroutine cartclinrefsidecplx2d1(
 ccart_clinref_op_side_2d(`double complex',1,0)dnl
 c
+c***********************************************************************
+c Linear time interpolation fused with conservative linear
+c interpolation for 2d cell-centered double data
+c***********************************************************************
+c
+      subroutine cartlintimeclinrefcelldoub2d(
+cart_lintime_clinref_op_cell_2d(`double precision')dnl
+c
+c***********************************************************************
+c Linear time interpolation fused with conservative linear
+c interpolation for 2d side-centered double data
+c***********************************************************************
+c
+      subroutine cartlintimeclinrefsidedoub2d0(
+cart_lintime_clinref_op_side_2d(`double precision',0,1)dnl
+c
+      subroutine cartlintimeclinrefsidedoub2d1(
+cart_lintime_clinref_op_side_2d(`double precision',1,0)dnl
+c
+c***********************************************************************
+c Linear time interpolation fused with linear interpolation for 2d
+c node-centered double data
+c***********************************************************************
+c
+      subroutine cartlintimelinrefnodedoub2d(
+cart_lintime_linref_op_node_2d(`double precision')dnl
+c
@@ -214,3 +214,33 @@ c
 c      subroutine cartclinrefsidecplx3d2(
 ccart_clinref_op_side_3d(`double complex',2,0,1)dnl
 c
+c***********************************************************************
+c Linear time interpolation fused with conservative linear
+c interpolation for 3d cell-centered double data
+c***********************************************************************
+c
+      subroutine cartlintimeclinrefcelldoub3d(
+cart_lintime_clinref_op_cell_3d(`double precision')dnl
+c
+c***********************************************************************
+c Linear time interpolation fused with conservative linear
+c interpolation for 3d side-centered double data
+c***********************************************************************
+c
+      subroutine cartlintimeclinrefsidedoub3d0(
+cart_lintime_clinref_op_side_3d(`double precision',0,1,2)dnl
+c
+      subroutine cartlintimeclinrefsidedoub3d1(
+cart_lintime_clinref_op_side_3d(`double precision',1,2,0)dnl
+c
+      subroutine cartlintimeclinrefsidedoub3d2(
+cart_lintime_clinref_op_side_3d(`double precision',2,0,1)dnl
+c
+c***********************************************************************
+c Linear time interpolation fused with linear interpolation for 3d
+c node-centered double data
+c***********************************************************************
+c
+      subroutine cartlintimelinrefnodedoub3d(
+cart_lintime_linref_op_node_3d(`double precision')dnl
+c
@@ -61,6 +61,76 @@ c
      &  deltax(0:15,0:NDIM-1)
 ')dnl
 c
+define(cart_lintime_refine_op_subroutine_head_1d,`dnl
+     &  ifirstc0,ilastc0,
+     &  ifirstf0,ilastf0,
+     &  oilo0,oihi0,
+     &  nilo0,nihi0,
+     &  filo0,fihi0,
+     &  ratio,dxc,dxf,tfrac,
+     &  arrayco,arraycn,arrayf)
+c***********************************************************************
+      implicit none
+      double precision half,one
+      parameter (half=0.5d0)
+      parameter (one=1.0d0)
+c
+      integer
+     &  ifirstc0,ilastc0,
+     &  ifirstf0,ilastf0,
+     &  oilo0,oihi0,
+     &  nilo0,nihi0,
+     &  filo0,fihi0
+      integer ratio(0:NDIM-1)
+      double precision
+     &  dxc(0:NDIM-1),
+     &  dxf(0:NDIM-1),
+     &  tfrac,oldfrac
+')dnl
+c
+define(cart_lintime_clinrefine_op_subroutine_head_1d,`dnl
+     &  ifirstc0,ilastc0,
+     &  ifirstf0,ilastf0,
+     &  oilo0,oihi0,
+     &  nilo0,nihi0,
+     &  filo0,fihi0,
+     &  ratio,dxc,dxf,tfrac,
+     &  arrayco,arraycn,arrayf,
+     &  diff0,slope0)
+c***********************************************************************
+      implicit none
+      double precision zero,half,one,two
+      parameter (zero=0.d0)
+      parameter (half=0.5d0)
+      parameter (one=1.d0)
+      parameter (two=2.d0)
+c
+      integer
+     &  ifirstc0,ilastc0,
+     &  ifirstf0,ilastf0,
+     &  oilo0,oihi0,
+     &  nilo0,nihi0,
+     &  filo0,fihi0
+      integer ratio(0:NDIM-1)
+      double precision
+     &  dxc(0:NDIM-1),
+     &  dxf(0:NDIM-1),
+     &  deltax(0:15,0:NDIM-1),
+     &  tfrac,oldfrac
+')dnl
+c
+define(lintime_coarse_statement_function_1d,`dnl
+      $1 arrayc
+      integer ja0
+c
+c     coarse data time interpolated where the refinement reads it
+c
+      arrayc(ja0)=arrayco(ja0)*oldfrac
+     &           +arraycn(ja0)*tfrac
+c
+      oldfrac=one-tfrac
+')dnl
+c
 define(cart_linref_cell_body_1d,`dnl
 c
 c***********************************************************************
@@ -257,3 +327,42 @@ c
       return
       end
 ')dnl
+define(cart_lintime_clinref_op_cell_1d,`dnl
+cart_lintime_clinrefine_op_subroutine_head_1d()dnl
+      $1
+     &  arrayco(CELL1d(oilo,oihi,0)),
+     &  arraycn(CELL1d(nilo,nihi,0)),
+     &  arrayf(CELL1d(filo,fihi,0)),
+     &  diff0(ifirstc0-1:ilastc0+1),
+     &  slope0(CELL1d(ifirstc,ilastc,0))
+      integer ic0,ie0,if0,ir0
+      $1
+     &  coef2,bound
+lintime_coarse_statement_function_1d($1)dnl
+cart_clinref_cell_body_1d(`')dnl
+')dnl
+define(cart_lintime_linref_op_node_1d,`dnl
+cart_lintime_refine_op_subroutine_head_1d()dnl
+      $1
+     &  arrayco(NODE1d(oilo,oihi,0)),
+     &  arraycn(NODE1d(nilo,nihi,0)),
+     &  arrayf(NODE1d(filo,fihi,0))
+      double precision realrat,x
+      integer ic0,if0,ie0,ir0
+lintime_coarse_statement_function_1d($1)dnl
+cart_linref_node_body_1d()dnl
+')dnl
+define(cart_lintime_clinref_op_side_1d,`dnl
+cart_lintime_clinrefine_op_subroutine_head_1d()dnl
+      $1
+     &  arrayco(SIDE1d(oilo,oihi,0)),
+     &  arraycn(SIDE1d(nilo,nihi,0)),
+     &  arrayf(SIDE1d(filo,fihi,0)),
+     &  diff0(ifirstc0-1:ilastc0+1),
+     &  slope0(SIDE1d(ifirstc,ilastc,0))
+      integer ic0,ie0,if0,ir0
+      $1
+     &  coef2,bound
+lintime_coarse_statement_function_1d($1)dnl
+cart_clinref_face_body_1d()dnl
+')dnl
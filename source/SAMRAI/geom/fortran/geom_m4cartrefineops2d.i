@@ -61,6 +61,76 @@ c
      &  deltax(0:15,0:NDIM-1)
 ')dnl
 c
+define(cart_lintime_refine_op_subroutine_head_2d,`dnl
+     &  ifirstc0,ifirstc1,ilastc0,ilastc1,
+     &  ifirstf0,ifirstf1,ilastf0,ilastf1,
+     &  oilo0,oilo1,oihi0,oihi1,
+     &  nilo0,nilo1,nihi0,nihi1,
+     &  filo0,filo1,fihi0,fihi1,
+     &  ratio,dxc,dxf,tfrac,
+     &  arrayco,arraycn,arrayf)
+c***********************************************************************
+      implicit none
+      double precision half,one
+      parameter (half=0.5d0)
+      parameter (one=1.d0)
+c
+      integer
+     &  ifirstc0,ifirstc1,ilastc0,ilastc1,
+     &  ifirstf0,ifirstf1,ilastf0,ilastf1,
+     &  oilo0,oilo1,oihi0,oihi1,
+     &  nilo0,nilo1,nihi0,nihi1,
+     &  filo0,filo1,fihi0,fihi1
+      integer ratio(0:NDIM-1)
+      double precision
+     &  dxc(0:NDIM-1),
+     &  dxf(0:NDIM-1),
+     &  tfrac,oldfrac
+')dnl
+c
+define(cart_lintime_clinrefine_op_subroutine_head_2d,`dnl
+     &  ifirstc0,ifirstc1,ilastc0,ilastc1,
+     &  ifirstf0,ifirstf1,ilastf0,ilastf1,
+     &  oilo0,oilo1,oihi0,oihi1,
+     &  nilo0,nilo1,nihi0,nihi1,
+     &  filo0,filo1,fihi0,fihi1,
+     &  ratio,dxc,dxf,tfrac,
+     &  arrayco,arraycn,arrayf,
+     &  diff$1,slope$1,diff$2,slope$2)
+c***********************************************************************
+      implicit none
+      double precision zero,half,one,two
+      parameter (zero=0.d0)
+      parameter (half=0.5d0)
+      parameter (one=1.0d0)
+      parameter (two=2.d0)
+c
+      integer
+     &  ifirstc0,ifirstc1,ilastc0,ilastc1,
+     &  ifirstf0,ifirstf1,ilastf0,ilastf1,
+     &  oilo0,oilo1,oihi0,oihi1,
+     &  nilo0,nilo1,nihi0,nihi1,
+     &  filo0,filo1,fihi0,fihi1
+      integer ratio(0:NDIM-1)
+      double precision
+     &  dxc(0:NDIM-1),
+     &  dxf(0:NDIM-1),
+     &  deltax(0:15,0:NDIM-1),
+     &  tfrac,oldfrac
+')dnl
+c
+define(lintime_coarse_statement_function_2d,`dnl
+      $1 arrayc
+      integer ja0,ja1
+c
+c     coarse data time interpolated where the refinement reads it
+c
+      arrayc(ja0,ja1)=arrayco(ja0,ja1)*oldfrac
+     &                +arraycn(ja0,ja1)*tfrac
+c
+      oldfrac=one-tfrac
+')dnl
+c
 define(cart_linref_cell_body_2d,`dnl
 c
 c***********************************************************************
@@ -410,3 +480,48 @@ cart_clinrefine_op_subroutine_head_2d($2,$3)dnl
      &  coef2,bound
 cart_clinref_outerface_body_2d($3)dnl
 ')dnl
+define(cart_lintime_clinref_op_cell_2d,`dnl
+cart_lintime_clinrefine_op_subroutine_head_2d(0,1)dnl
+      $1
+     &  arrayco(CELL2d(oilo,oihi,0)),
+     &  arraycn(CELL2d(nilo,nihi,0)),
+     &  arrayf(CELL2d(filo,fihi,0)),
+     &  diff0(ifirstc0-1:ilastc0+1),
+     &  slope0(CELL2d(ifirstc,ilastc,0)),
+     &  diff1(ifirstc1-1:ilastc1+1),
+     &  slope1(CELL2d(ifirstc,ilastc,0))
+      integer ic0,ic1,ie0,ie1,if0,if1,ir0,ir1
+      $1
+     &  coef2,bound
+      double precision deltax1
+lintime_coarse_statement_function_2d($1)dnl
+cart_clinref_cell_body_2d(`')dnl
+')dnl
+define(cart_lintime_linref_op_node_2d,`dnl
+cart_lintime_refine_op_subroutine_head_2d()dnl
+      $1
+     &  arrayco(NODE2d(oilo,oihi,0)),
+     &  arraycn(NODE2d(nilo,nihi,0)),
+     &  arrayf(NODE2d(filo,fihi,0))
+      double precision x,y,realrat0,realrat1
+      integer ic0,ic1,if0,if1,ie0,ie1,ir0,ir1
+lintime_coarse_statement_function_2d($1)dnl
+cart_linref_node_body_2d()dnl
+')dnl
+define(cart_lintime_clinref_op_side_2d,`dnl
+cart_lintime_clinrefine_op_subroutine_head_2d($2,$3)dnl
+      $1
+     &  arrayco(SIDE2d$2(oilo,oihi,0)),
+     &  arraycn(SIDE2d$2(nilo,nihi,0)),
+     &  arrayf(SIDE2d$2(filo,fihi,0)),
+     &  diff$2(ifirstc$2-1:ilastc$2+1),
+     &  slope$2(SIDE2d$2(ifirstc,ilastc,0)),
+     &  diff$3(ifirstc$3-1:ilastc$3+1),
+     &  slope$3(SIDE2d$2(ifirstc,ilastc,0))
+      integer ic0,ic1,ie0,ie1,if0,if1,ir0,ir1
+      $1
+     &  coef2,bound
+      double precision deltax1
+lintime_coarse_statement_function_2d($1)dnl
+cart_clinref_side_body_2d($2,$3)dnl
+')dnl
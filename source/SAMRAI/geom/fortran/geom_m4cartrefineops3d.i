@@ -61,6 +61,76 @@ c
      &  deltax(0:15,0:NDIM-1)
 ')dnl
 c
+define(cart_lintime_refine_op_subroutine_head_3d,`dnl
+     &  ifirstc0,ifirstc1,ifirstc2,ilastc0,ilastc1,ilastc2,
+     &  ifirstf0,ifirstf1,ifirstf2,ilastf0,ilastf1,ilastf2,
+     &  oilo0,oilo1,oilo2,oihi0,oihi1,oihi2,
+     &  nilo0,nilo1,nilo2,nihi0,nihi1,nihi2,
+     &  filo0,filo1,filo2,fihi0,fihi1,fihi2,
+     &  ratio,dxc,dxf,tfrac,
+     &  arrayco,arraycn,arrayf)
+c***********************************************************************
+      implicit none
+      double precision half,one
+      parameter (half=0.5d0)
+      parameter (one=1.0d0)
+c
+      integer
+     &  ifirstc0,ifirstc1,ifirstc2,ilastc0,ilastc1,ilastc2,
+     &  ifirstf0,ifirstf1,ifirstf2,ilastf0,ilastf1,ilastf2,
+     &  oilo0,oilo1,oilo2,oihi0,oihi1,oihi2,
+     &  nilo0,nilo1,nilo2,nihi0,nihi1,nihi2,
+     &  filo0,filo1,filo2,fihi0,fihi1,fihi2
+      integer ratio(0:NDIM-1)
+      double precision
+     &  dxc(0:NDIM-1),
+     &  dxf(0:NDIM-1),
+     &  tfrac,oldfrac
+')dnl
+c
+define(cart_lintime_clinrefine_op_subroutine_head_3d,`dnl
+     &  ifirstc0,ifirstc1,ifirstc2,ilastc0,ilastc1,ilastc2,
+     &  ifirstf0,ifirstf1,ifirstf2,ilastf0,ilastf1,ilastf2,
+     &  oilo0,oilo1,oilo2,oihi0,oihi1,oihi2,
+     &  nilo0,nilo1,nilo2,nihi0,nihi1,nihi2,
+     &  filo0,filo1,filo2,fihi0,fihi1,fihi2,
+     &  ratio,dxc,dxf,tfrac,
+     &  arrayco,arraycn,arrayf,
+     &  diff$1,slope$1,diff$2,slope$2,diff$3,slope$3)
+c***********************************************************************
+      implicit none
+      double precision zero,half,one,two
+      parameter (zero=0.d0)
+      parameter (half=0.5d0)
+      parameter (one=1.d0)
+      parameter (two=2.d0)
+c
+      integer
+     &  ifirstc0,ifirstc1,ifirstc2,ilastc0,ilastc1,ilastc2,
+     &  ifirstf0,ifirstf1,ifirstf2,ilastf0,ilastf1,ilastf2,
+     &  oilo0,oilo1,oilo2,oihi0,oihi1,oihi2,
+     &  nilo0,nilo1,nilo2,nihi0,nihi1,nihi2,
+     &  filo0,filo1,filo2,fihi0,fihi1,fihi2
+      integer ratio(0:NDIM-1)
+      double precision
+     &  dxc(0:NDIM-1),
+     &  dxf(0:NDIM-1),
+     &  deltax(0:15,0:NDIM-1),
+     &  tfrac,oldfrac
+')dnl
+c
+define(lintime_coarse_statement_function_3d,`dnl
+      $1 arrayc
+      integer ja0,ja1,ja2
+c
+c     coarse data time interpolated where the refinement reads it
+c
+      arrayc(ja0,ja1,ja2)=arrayco(ja0,ja1,ja2)*oldfrac
+     &                    +arraycn(ja0,ja1,ja2)*tfrac
+c
+      oldfrac=one-tfrac
+')dnl
+c
 define(cart_linref_cell_body_3d,`dnl
 c
 c***********************************************************************
@@ -631,3 +701,53 @@ cart_clinrefine_op_subroutine_head_3d($2,$3,$4)dnl
       double precision deltax2,deltax1
 cart_clinref_side_body_3d($2,$3,$4)dnl
 ')dnl
+define(cart_lintime_clinref_op_cell_3d,`dnl
+cart_lintime_clinrefine_op_subroutine_head_3d(0,1,2)dnl
+      $1
+     &  arrayco(CELL3d(oilo,oihi,0)),
+     &  arraycn(CELL3d(nilo,nihi,0)),
+     &  arrayf(CELL3d(filo,fihi,0)),
+     &  diff0(ifirstc0-1:ilastc0+1),
+     &  slope0(CELL3d(ifirstc,ilastc,0)),
+     &  diff1(ifirstc1-1:ilastc1+1),
+     &  slope1(CELL3d(ifirstc,ilastc,0)),
+     &  diff2(ifirstc2-1:ilastc2+1),
+     &  slope2(CELL3d(ifirstc,ilastc,0))
+      integer ic0,ic1,ic2,ie0,ie1,ie2,if0,if1,if2,ir0,ir1,ir2
+      $1
+     &  coef2,bound
+      double precision deltax1,deltax2
+lintime_coarse_statement_function_3d($1)dnl
+cart_clinref_cell_body_3d(`')dnl
+')dnl
+define(cart_lintime_linref_op_node_3d,`dnl
+cart_lintime_refine_op_subroutine_head_3d()dnl
+      $1
+     &  arrayco(NODE3d(oilo,oihi,0)),
+     &  arraycn(NODE3d(nilo,nihi,0)),
+     &  arrayf(NODE3d(filo,fihi,0))
+      double precision x,y,z,realrat0,realrat1,realrat2
+      integer ic0,ic1,ic2,ie0,ie1,ie2,if0,if1,if2,ir0,ir1,ir2
+lintime_coarse_statement_function_3d($1)dnl
+cart_linref_node_body_3d()dnl
+')dnl
+define(cart_lintime_clinref_op_side_3d,`dnl
+cart_lintime_clinrefine_op_subroutine_head_3d($2,$3,$4)dnl
+      $1
+     &  arrayco(SIDE3d$2(oilo,oihi,0)),
+     &  arraycn(SIDE3d$2(nilo,nihi,0)),
+     &  arrayf(SIDE3d$2(filo,fihi,0)),
+     &  diff$2(ifirstc$2-1:ilastc$2+1),
+     &  slope$2(SIDE3d$2(ifirstc,ilastc,0)),
+     &  diff$3(ifirstc$3-1:ilastc$3+1),
+     &  slope$3(SIDE3d$2(ifirstc,ilastc,0)),
+     &  diff$4(ifirstc$4-1:ilastc$4+1),
+     &  slope$4(SIDE3d$2(ifirstc,ilastc,0))
+      integer ic0,ic1,ic2,ie0,ie1,ie2,if0,if1,if2,
+     &        ir0,ir1,ir2
+      $1
+     &  coef2,bound
+      double precision deltax2,deltax1
+lintime_coarse_statement_function_3d($1)dnl
+cart_clinref_side_body_3d($2,$3,$4)dnl
+')dnl
@@ -21,6 +21,7 @@
 #include "SAMRAI/hier/PeriodicShiftCatalog.h"
 #include "SAMRAI/hier/RefineOperator.h"
 #include "SAMRAI/hier/TimeInterpolateOperator.h"
+#include "SAMRAI/hier/TimeRefineOperator.h"
 #include "SAMRAI/hier/TransferOperatorRegistry.h"
 #include "SAMRAI/hier/Transformation.h"
 
@@ -676,6 +677,25 @@ public:
          time_op);
    }
 
+   /*!
+    * @brief Add a concrete fused time interpolation and refinement
+    * operator.
+    *
+    * @param[in]  var_type_name The type name of the variable with which
+    *             time_refine_op is associated.
+    * @param[in]  time_refine_op The concrete fused operator to add to the
+    *             lookup list.
+    */
+   void
+   addTimeRefineOperator(
+      const char* var_type_name,
+      const std::shared_ptr<TimeRefineOperator>& time_refine_op)
+   {
+      d_transfer_operator_registry->addTimeRefineOperator(
+         var_type_name,
+         time_refine_op);
+   }
+
    /*!
     * @brief Lookup function for coarsening operator.
     *
@@ -741,6 +761,33 @@ public:
          var, op_name);
    }
 
+   /*!
+    * @brief Lookup function for fused time interpolation and refinement
+    * operator.
+    *
+    * Search list for the operator fusing the named refinement and time
+    * interpolation operators for the given variable.  A null pointer is
+    * returned if there is no such operator.
+    *
+    * @param[in]     var The Variable for which the corresponding fused
+    *                operator should match.
+    * @param[in]     refine_op_name The string identifier of the fused
+    *                refinement operator.
+    * @param[in]     time_op_name The string identifier of the fused time
+    *                interpolation operator.
+    *                \b Default: STD_LINEAR_TIME_INTERPOLATE
+    */
+   std::shared_ptr<TimeRefineOperator>
+   lookupTimeRefineOperator(
+      const std::shared_ptr<Variable>& var,
+      const std::string& refine_op_name,
+      const std::string& time_op_name =
+         "STD_LINEAR_TIME_INTERPOLATE")
+   {
+      return d_transfer_operator_registry->lookupTimeRefineOperator(
+         var, refine_op_name, time_op_name);
+   }
+
    /*!
     * @brief Set a minimum value on the value returned by
     * getMaxTransferOpStencilWidth().
@@ -0,0 +1,141 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2018 Lawrence Livermore National Security, LLC
+ * Description:   Decomposition of a box into cache-sized tiles
+ *
+ ************************************************************************/
+
+#ifndef included_hier_BoxTiling
+#define included_hier_BoxTiling
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/IntVector.h"
+
+namespace SAMRAI {
+namespace hier {
+
+/*!
+ * @brief Class BoxTiling decomposes a Box into a regular array of tiles.
+ *
+ * Tiles are boxes of at most the tile size in each direction that
+ * together cover the box exactly, with no overlap.  Only the tiles at the
+ * upper end of the box in a direction may be smaller than the tile size.
+ * A tile size component that is not positive, or that is at least the
+ * box width, leaves that direction unsplit, so a zero tile size gives a
+ * single tile equal to the box.
+ *
+ * Tiles are numbered with direction 0 varying fastest and are computed
+ * on demand by getTile(), so a loop over the tiles may be distributed
+ * among threads.  Working on one tile at a time keeps the data touched by
+ * a kernel in cache and lets large patches be shared among threads; see
+ * Patch::processTiles() and PatchLevel::processTiles().
+ *
+ * A process-wide default tile size, used by the framework's own tiled
+ * kernels (e.g., math::PatchCellDataBasicOps), is set with
+ * setDefaultTileSize().  It is zero, meaning no tiling, unless changed.
+ */
+class BoxTiling
+{
+public:
+   /*!
+    * @brief Construct the tiling of a box.
+    *
+    * @param[in] box        The box to decompose.
+    * @param[in] tile_size  Maximum tile width in each direction.
+    *
+    * @pre box.getDim() == tile_size.getDim()
+    */
+   BoxTiling(
+      const Box& box,
+      const IntVector& tile_size);
+
+   /*!
+    * @brief Destructor.
+    */
+   ~BoxTiling();
+
+   /*!
+    * @brief Return the box that is tiled.
+    */
+   const Box&
+   getBox() const
+   {
+      return d_box;
+   }
+
+   /*!
+    * @brief Return the number of tiles, which is 0 only for an empty box.
+    */
+   int
+   getNumberOfTiles() const
+   {
+      return d_number_tiles;
+   }
+
+   /*!
+    * @brief Return the tile with the given number.
+    *
+    * The tile has the block id of the tiled box.
+    *
+    * @pre (tile_number >= 0) && (tile_number < getNumberOfTiles())
+    */
+   Box
+   getTile(
+      const int tile_number) const;
+
+   /*!
+    * @brief Set the default tile size used by the framework's tiled
+    * kernels.
+    *
+    * Components beyond the dimension of tile_size are left unsplit.  A
+    * zero tile size turns tiling off.
+    */
+   static void
+   setDefaultTileSize(
+      const IntVector& tile_size);
+
+   /*!
+    * @brief Return the default tile size for the given dimension.
+    */
+   static IntVector
+   getDefaultTileSize(
+      const tbox::Dimension& dim);
+
+private:
+   // The following are not implemented.
+   BoxTiling();
+   BoxTiling(
+      const BoxTiling&);
+   BoxTiling&
+   operator = (
+      const BoxTiling&);
+
+   /*!
+    * @brief The tiled box.
+    */
+   Box d_box;
+
+   /*!
+    * @brief Tile width in each direction, clipped to the box width.
+    */
+   int d_tile_width[SAMRAI::MAX_DIM_VAL];
+
+   /*!
+    * @brief Number of tiles in each direction.
+    */
+   int d_tiles_per_direction[SAMRAI::MAX_DIM_VAL];
+
+   int d_number_tiles;
+
+   static int s_default_tile_size[SAMRAI::MAX_DIM_VAL];
+};
+
+}
+}
+
+#endif
@@ -20,6 +20,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <memory>
 
 namespace SAMRAI {
@@ -65,6 +66,32 @@ namespace hier {
 class CoarsenOperator
 {
 public:
+   /*!
+    * @brief One coarsening in a batch passed to coarsenBatch().
+    *
+    * A work item names the coarse and fine patches, the box on the coarse
+    * patch over which to coarsen and the refinement ratio between the
+    * patches.  The item does not own the patches it points to.
+    */
+   struct WorkItem {
+      WorkItem(
+         Patch& coarse,
+         const Patch& fine,
+         const Box& coarse_box,
+         const IntVector& ratio):
+         d_coarse(&coarse),
+         d_fine(&fine),
+         d_coarse_box(coarse_box),
+         d_ratio(ratio)
+      {
+      }
+
+      Patch* d_coarse;
+      const Patch* d_fine;
+      Box d_coarse_box;
+      IntVector d_ratio;
+   };
+
    /*!
     * @brief Construct the object with a name to allow the
     * TransferOperatorRegistry class to look up the object using a
@@ -73,9 +100,18 @@ public:
     * The constructor must be given a name.  The object will be
     * registered under this name with the TransferOperatorRegistry class.
     * The name must be unique, as duplicate names are not allowed.
+    *
+    * An operator whose coarsen() may be called concurrently for work items
+    * on different coarse patches passes true for threaded_batch.  The
+    * default coarsenBatch() then dispatches the items of a batch over the
+    * OpenMP threads.
+    *
+    * @param[in] name
+    * @param[in] threaded_batch
     */
    CoarsenOperator(
-      const std::string& name);
+      const std::string& name,
+      bool threaded_batch = false);
 
    /**
     * The virtual destructor for the coarsening operator does
@@ -129,6 +165,35 @@ public:
       const Box& coarse_box,
       const IntVector& ratio) const = 0;
 
+   /*!
+    * @brief Coarsen the source component to the destination component for
+    * every work item in a batch.
+    *
+    * The communication schedules collect the coarsenings of a level for
+    * one operator and pass them here in a single call.  The default
+    * implementation calls coarsen() on each work item.  If the operator was
+    * constructed with threaded_batch, work items that share a coarse patch
+    * are processed in their batch order by one thread, and different coarse
+    * patches run concurrently when OpenMP is enabled.  Otherwise the items
+    * are processed in order.
+    *
+    * The default implementation only dispatches the work items: each item
+    * still goes through coarsen(), so per-item setup such as the patch data
+    * casts, patch geometry lookups and array bounds is not shared between
+    * items.  Operators that can share such setup across a batch should
+    * override this method to do so.
+    *
+    * @param[in] items  Work items, in the order a serial coarsening would
+    *                   process them
+    * @param[in] dst_component  Patch data index on the coarse patches
+    * @param[in] src_component  Patch data index on the fine patches
+    */
+   virtual void
+   coarsenBatch(
+      const std::vector<WorkItem>& items,
+      const int dst_component,
+      const int src_component) const;
+
    /*!
     * @brief Get the max stencil width of all coarsen operators.
     *
@@ -146,6 +211,26 @@ private:
    operator = (
       const CoarsenOperator&);                  // not implemented
 
+   /*!
+    * @brief Coarsen a batch of work items, running items on different
+    * coarse patches concurrently when OpenMP is enabled.
+    *
+    * Work items that share a coarse patch are coarsened in their batch
+    * order by a single thread.
+    *
+    * This is a threaded dispatch of coarsen() over the items: it calls
+    * coarsen() once per item and adds no batched computation of its own.
+    *
+    * @param[in] items
+    * @param[in] dst_component
+    * @param[in] src_component
+    */
+   void
+   coarsenBatchThreaded(
+      const std::vector<WorkItem>& items,
+      const int dst_component,
+      const int src_component) const;
+
    /*
     * TODO SGS Rich has better way of doing this.
     */
@@ -183,6 +268,11 @@ private:
 
    const std::string d_name;
 
+   /*!
+    * @brief Whether coarsenBatch() may run work items concurrently.
+    */
+   const bool d_threaded_batch;
+
    static std::multimap<std::string, CoarsenOperator *> s_lookup_table;
    static TBOX_omp_lock_t l_lookup_table;
 
@@ -16,6 +16,7 @@
 #include "SAMRAI/hier/HierarchyNeighbors.h"
 #include "SAMRAI/hier/PatchHierarchy.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <memory>
@@ -105,16 +106,15 @@ public:
    {
       TBOX_ASSERT(ln <= d_finest_level && ln >= d_coarsest_level);
 
-      std::map<BoxId, BoxContainer >::const_iterator itr =
-         d_visible_boxes[ln].find(box.getBoxId());
+      const int index = findPatchIndex(box.getBoxId(), ln);
 
-      if (itr == d_visible_boxes[ln].end()) {
+      if (index < 0) {
          TBOX_ERROR("FlattenedHierarchy::getVisibleBoxes error: Box "
             << box << " does not exist locally on level " << ln << ".\n"
             << "You must specify the Box of a current local patch.");
       }
 
-      return itr->second;
+      return d_visible_boxes[index];
    }
 
    /*
@@ -145,20 +145,53 @@ public:
 
 private:
 
+   /*!
+    * @brief Return the index into d_visible_boxes of a local patch on
+    * level ln, or -1 if there is no such patch.
+    */
+   int findPatchIndex(const BoxId& box_id, int ln) const
+   {
+      const std::vector<BoxId>::const_iterator level_begin =
+         d_patch_box_ids.begin() + d_level_offsets[ln];
+      const std::vector<BoxId>::const_iterator level_end =
+         d_patch_box_ids.begin() + d_level_offsets[ln + 1];
+      const std::vector<BoxId>::const_iterator itr =
+         std::lower_bound(level_begin, level_end, box_id);
+
+      if (itr == level_end || *itr != box_id) {
+         return -1;
+      }
+      return static_cast<int>(itr - d_patch_box_ids.begin());
+   }
+
    /*!
     * Level numbers for the range of levels represented in this object.
     */
    int d_coarsest_level;
    int d_finest_level;
 
+   /*!
+    * @brief Offsets of each level's entries in d_patch_box_ids and
+    * d_visible_boxes.
+    *
+    * The entries for level ln are in [d_level_offsets[ln],
+    * d_level_offsets[ln+1]).  Levels outside the represented range have no
+    * entries.
+    */
+   std::vector<int> d_level_offsets;
+
+   /*!
+    * @brief BoxIds of the local patches, sorted within each level.
+    */
+   std::vector<BoxId> d_patch_box_ids;
+
    /*!
     * @brief Container for the boxes in the flattened hierarchy representation
     *
-    * The vector is indexed by level number, and for each level, the BoxId
-    * of a Patch is mapped to a BoxContainer holding the visible parts of
-    * that Patch's box.
+    * Entry i holds the visible parts of the box of the patch whose BoxId is
+    * d_patch_box_ids[i].
     */
-   std::vector< std::map<BoxId, BoxContainer> > d_visible_boxes;
+   std::vector<BoxContainer> d_visible_boxes;
 
    /*!
     * @brief Pointer to the PatchHierarchy that was used to create this object.
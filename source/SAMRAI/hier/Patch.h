@@ -14,11 +14,13 @@
 #include "SAMRAI/SAMRAI_config.h"
 
 #include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/BoxTiling.h"
 #include "SAMRAI/hier/ComponentSelector.h"
 #include "SAMRAI/hier/PatchData.h"
 #include "SAMRAI/hier/PatchDataFactory.h"
 #include "SAMRAI/hier/PatchDescriptor.h"
 #include "SAMRAI/hier/PatchGeometry.h"
+#include "SAMRAI/hier/PatchTileStrategy.h"
 #include "SAMRAI/hier/Variable.h"
 #include "SAMRAI/hier/VariableContext.h"
 #include "SAMRAI/hier/VariableDatabase.h"
@@ -346,6 +348,36 @@ public:
       return d_patch_geometry;
    }
 
+   /*!
+    * @brief Get the number of bytes of metadata held by the patch.
+    *
+    * This counts the Patch object, its patch data pointer array, and its
+    * PatchGeometry (see PatchGeometry::getMetadataBytes()).  Patch data
+    * storage and objects shared with other patches, such as the
+    * PatchDescriptor, are not counted.
+    */
+   size_t
+   getMetadataBytes() const;
+
+   /*!
+    * @brief Apply an operation to each tile of the patch box.
+    *
+    * The patch box is split into tiles of at most tile_size cells in each
+    * direction (see BoxTiling), and strategy.processTile() is called once
+    * per tile.  When SAMRAI is built with OpenMP, the tiles are shared
+    * among the threads, so a single large patch can use several cores.
+    *
+    * @param[in,out] strategy  Operation applied to each tile.
+    * @param[in] tile_size     Maximum tile width in each direction; a zero
+    *                          component leaves that direction unsplit.
+    *
+    * @pre getDim() == tile_size.getDim()
+    */
+   void
+   processTiles(
+      PatchTileStrategy& strategy,
+      const IntVector& tile_size);
+
    /*!
     * @brief Set the timestamp value for the specified patch component.
     *
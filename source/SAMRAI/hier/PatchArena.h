@@ -0,0 +1,108 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2018 Lawrence Livermore National Security, LLC
+ * Description:   Contiguous storage for the Patch objects of a level
+ *
+ ************************************************************************/
+
+#ifndef included_hier_PatchArena
+#define included_hier_PatchArena
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/Patch.h"
+#include "SAMRAI/hier/PatchDescriptor.h"
+
+#include <memory>
+
+namespace SAMRAI {
+namespace hier {
+
+/*!
+ * @brief Class PatchArena holds a fixed number of Patch objects in a
+ * single contiguous block of memory.
+ *
+ * PatchFactory uses an arena to create all patches of a PatchLevel with
+ * one allocation instead of one allocation per patch.  The patches are
+ * handed out as std::shared_ptr objects that share ownership of the
+ * arena (through the aliasing constructor of std::shared_ptr), so the
+ * arena and every Patch in it live until the last of those pointers is
+ * released.  This makes levels made of very many small patches, such as
+ * those produced by tile clustering, cheaper to build and to destroy.
+ *
+ * @see PatchFactory
+ */
+class PatchArena
+{
+public:
+   /*!
+    * @brief Reserve storage for the given number of patches.
+    *
+    * No Patch is constructed until construct() is called.
+    *
+    * @param[in] capacity  Maximum number of patches held by the arena.
+    */
+   explicit PatchArena(
+      const size_t capacity);
+
+   /*!
+    * @brief Destroy the constructed patches and release the storage.
+    */
+   ~PatchArena();
+
+   /*!
+    * @brief Construct the next Patch of the arena in place.
+    *
+    * @return Pointer to the new Patch, owned by the arena.
+    *
+    * @pre getNumberOfPatches() < getCapacity()
+    */
+   Patch *
+   construct(
+      const Box& box,
+      const std::shared_ptr<PatchDescriptor>& descriptor);
+
+   /*!
+    * @brief Return the number of patches constructed in the arena.
+    */
+   size_t
+   getNumberOfPatches() const
+   {
+      return d_size;
+   }
+
+   /*!
+    * @brief Return the maximum number of patches the arena can hold.
+    */
+   size_t
+   getCapacity() const
+   {
+      return d_capacity;
+   }
+
+private:
+   // The following are not implemented.
+   PatchArena(
+      const PatchArena&);
+   PatchArena&
+   operator = (
+      const PatchArena&);
+
+   /*!
+    * @brief Raw storage for d_capacity Patch objects.
+    */
+   Patch* d_patches;
+
+   size_t d_capacity;
+
+   size_t d_size;
+};
+
+}
+}
+
+#endif
@@ -216,6 +216,50 @@ public:
       tbox::MessageStream& stream,
       const BoxOverlap& overlap) = 0;
 
+   /**
+    * Return whether the data stream of this object consists only of
+    * double values, so that it can be communicated with reduced precision
+    * by packStreamWithPrecision().  The default is false; subclasses that
+    * stream only doubles may override it to return true.
+    */
+   virtual bool
+   canPackWithReducedPrecision() const;
+
+   /**
+    * Calculate the number of bytes needed to stream the data lying in the
+    * specified box domain with packStreamWithPrecision().  The size is an
+    * upper bound when precision is tbox::MessageStream::BoundedError.
+    */
+   size_t
+   getDataStreamSizeWithPrecision(
+      const BoxOverlap& overlap,
+      const tbox::MessageStream::PackPrecision precision) const;
+
+   /**
+    * Pack data lying on the specified index set into the output stream
+    * with the given precision (see tbox::MessageStream::packWithPrecision()).
+    * If canPackWithReducedPrecision() is false, the data is packed exactly
+    * with packStream().
+    *
+    * @return The largest absolute error introduced by the packing.
+    */
+   double
+   packStreamWithPrecision(
+      tbox::MessageStream& stream,
+      const BoxOverlap& overlap,
+      const tbox::MessageStream::PackPrecision precision,
+      const double error_bound) const;
+
+   /**
+    * Unpack data packed by packStreamWithPrecision() from the message
+    * stream into the specified index set, widening it back to double.
+    */
+   void
+   unpackStreamWithPrecision(
+      tbox::MessageStream& stream,
+      const BoxOverlap& overlap,
+      const tbox::MessageStream::PackPrecision precision);
+
    /**
     * Checks that class version and restart file version are equal.  If so,
     * reads in the data members common to all patch data types from restart
@@ -19,6 +19,7 @@
 #include "SAMRAI/tbox/Database.h"
 
 #include <memory>
+#include <vector>
 
 namespace SAMRAI {
 namespace hier {
@@ -54,6 +55,27 @@ public:
       const Box& box_level_box,
       const std::shared_ptr<PatchDescriptor>& descriptor) const;
 
+   /**
+    * Allocate one patch for each real (non-periodic-image) box in the
+    * container and append them to patches in the container's order.
+    *
+    * When called on this base factory, the patches are constructed in a
+    * single PatchArena shared by all of the returned pointers, so a level
+    * with many small patches needs one allocation rather than one per
+    * patch.  Derived factories are called through allocate() once per
+    * box so that their patch types are preserved; they may override this
+    * method to provide their own batched allocation.
+    *
+    * The arena is freed only when the last of its patch pointers is
+    * released.  A single pointer kept past the lifetime of its level thus
+    * keeps every patch of the level, and their patch data, alive.
+    */
+   virtual void
+   allocatePatches(
+      const BoxContainer& boxes,
+      const std::shared_ptr<PatchDescriptor>& descriptor,
+      std::vector<std::shared_ptr<Patch> >& patches) const;
+
 private:
    PatchFactory(
       const PatchFactory&);             // not implemented
@@ -335,6 +335,13 @@ private:
    printClassData(
       std::ostream& stream) const;
 
+   /**
+    * Return the number of bytes held by this object and its boundary
+    * boxes.  Data added by derived geometry classes is not counted.
+    */
+   size_t
+   getMetadataBytes() const;
+
    const tbox::Dimension&
    getDim() const
    {
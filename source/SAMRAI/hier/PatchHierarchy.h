@@ -200,6 +200,9 @@ namespace hier {
  * @see PatchDescriptor
  */
 
+class CoarseFineBoundary;
+class FlattenedHierarchy;
+
 class PatchHierarchy:public tbox::Serializable
 {
 public:
@@ -303,6 +306,36 @@ public:
          const PatchHierarchy& patch_hierarchy) const = 0;
    };
 
+   /*!
+    * @brief Strategy for objects keeping data that refers to the levels
+    * of a hierarchy, such as schedule caches, so that they can release
+    * the data as soon as a level is replaced or removed.
+    *
+    * Implementations are registered with registerLevelChangeStrategy()
+    * and must be unregistered with unregisterLevelChangeStrategy() before
+    * they are destroyed.
+    */
+   class LevelChangeStrategy
+   {
+public:
+      /*!
+       * @brief Destructor
+       */
+      virtual ~LevelChangeStrategy();
+
+      /*!
+       * @brief Called after a level of the hierarchy has been replaced,
+       * by makeNewPatchLevel(), or removed, by removePatchLevel().
+       *
+       * @param[in]  patch_hierarchy
+       * @param[in]  level_number
+       */
+      virtual void
+      levelChanged(
+         const PatchHierarchy& patch_hierarchy,
+         int level_number) = 0;
+   };
+
 /*
  * TODO: How does the hierarchy get properly initialized if the input
  * database argument is a null pointer?
@@ -648,6 +681,30 @@ public:
 
    //@}
 
+   //! @name Notification of level changes.
+
+   /*!
+    * @brief Register a LevelChangeStrategy to be told whenever a level is
+    * replaced or removed.
+    *
+    * @param[in]  lcs
+    */
+   void
+   registerLevelChangeStrategy(
+      LevelChangeStrategy& lcs);
+
+   /*!
+    * @brief Unregister a LevelChangeStrategy registered with
+    * registerLevelChangeStrategy().
+    *
+    * @param[in]  lcs
+    */
+   void
+   unregisterLevelChangeStrategy(
+      LevelChangeStrategy& lcs);
+
+   //@}
+
 /*
  * TODO: This DomainBoxLevel, etc. stuff (if it is really needed) should
  * be moved to the BaseGridGeometry class.  It makes the role of this class
@@ -1047,6 +1104,46 @@ public:
       return UncoveredBoxIterator(this, false);
    }
 
+   /*!
+    * @brief Get the coarse-fine boundary of a level.
+    *
+    * The boundary is computed on first request and cached by the
+    * hierarchy, so later requests for the same level and ghost width
+    * return the same object.  The cached boundary is discarded when the
+    * level is replaced or removed by makeNewPatchLevel() or
+    * removePatchLevel().  Callers holding the returned pointer keep a
+    * valid, but stale, description after that.
+    *
+    * @param[in]  level_number
+    * @param[in]  max_ghost_width  See CoarseFineBoundary
+    *
+    * @pre (level_number >= 0) && (level_number < getNumberOfLevels())
+    * @pre getDim() == max_ghost_width.getDim()
+    */
+   std::shared_ptr<const CoarseFineBoundary>
+   getCoarseFineBoundary(
+      const int level_number,
+      const IntVector& max_ghost_width) const;
+
+   /*!
+    * @brief Get the flattened representation of a range of levels.
+    *
+    * As with getCoarseFineBoundary(), the FlattenedHierarchy is computed on
+    * first request and cached until a level in the range
+    * [coarsest_level, finest_level] is replaced or removed.
+    *
+    * @param[in]  coarsest_level
+    * @param[in]  finest_level
+    *
+    * @pre coarsest_level >= 0
+    * @pre coarsest_level <= finest_level
+    * @pre finest_level < getNumberOfLevels()
+    */
+   std::shared_ptr<const FlattenedHierarchy>
+   getFlattenedHierarchy(
+      const int coarsest_level,
+      const int finest_level) const;
+
 private:
    /*
     * Static integer constant describing class's version number.
@@ -1060,6 +1157,27 @@ private:
    void
    computeRequiredConnectorWidths() const;
 
+   /*!
+    * @brief Discard cached metadata that depends on the given level.
+    *
+    * Called whenever the level is created, replaced or removed.
+    *
+    * @param[in]  level_number
+    */
+   void
+   invalidateCachedMetadata(
+      const int level_number);
+
+   /*!
+    * @brief Tell the registered LevelChangeStrategy objects that the
+    * given level has been replaced or removed.
+    *
+    * @param[in]  level_number
+    */
+   void
+   notifyLevelChanged(
+      const int level_number);
+
    /*!
     * @brief Read input data from specified database and initialize
     * class members.
@@ -1247,6 +1365,30 @@ private:
     */
    mutable bool d_connector_widths_committed;
 
+   //@{
+   //! @name Cached metadata computed from the patch levels.
+
+   /*!
+    * @brief Cached coarse-fine boundaries.
+    *
+    * Entry i is the boundary of level d_cf_boundary_cache_level[i] for the
+    * ghost width d_cf_boundary_cache_width[i].  The arrays are mutable
+    * because they are filled by the const getCoarseFineBoundary().
+    */
+   mutable std::vector<std::shared_ptr<const CoarseFineBoundary> >
+   d_cf_boundary_cache;
+   mutable std::vector<int> d_cf_boundary_cache_level;
+   mutable std::vector<IntVector> d_cf_boundary_cache_width;
+
+   /*!
+    * @brief Cached flattened hierarchies, each covering the level range
+    * given by its getCoarsestLevelNumber() and getFinestLevelNumber().
+    */
+   mutable std::vector<std::shared_ptr<const FlattenedHierarchy> >
+   d_flattened_hierarchy_cache;
+
+   //@}
+
    /*!
     * @brief Vector of all ConnectorWidthRequestorStrategy objects registered
     * with this particular object.
@@ -1257,6 +1399,12 @@ private:
     */
    std::vector<const ConnectorWidthRequestorStrategy *> d_individual_cwrs;
 
+   /*!
+    * @brief LevelChangeStrategy objects registered with
+    * registerLevelChangeStrategy().
+    */
+   std::vector<LevelChangeStrategy *> d_level_change_strategies;
+
    /*!
     * @brief All ConnectorWidthRequestorStrategy registered with
     * PatchHierarchy's auto-registry.
@@ -19,6 +19,7 @@
 #include "SAMRAI/hier/ProcessorMapping.h"
 #include "SAMRAI/tbox/Utilities.h"
 
+#include <algorithm>
 #include <map>
 #include <vector>
 #include <memory>
@@ -39,6 +40,15 @@ class BaseGridGeometry;
  * To iterate over the local patches in a patch level, use the patch
  * level iterator class (PatchLevel::Iterator).
  *
+ * The local patches are usually allocated together by
+ * PatchFactory::allocatePatches(), and every std::shared_ptr<Patch>
+ * returned by the level shares ownership of that one allocation.  Holding
+ * any of them therefore keeps all of the local patches of the level, and
+ * the patch data allocated on them, alive after the level itself is
+ * replaced or removed from its hierarchy.  Objects that keep patches of
+ * a level, such as RefineSchedule and CoarsenSchedule transactions,
+ * should be released along with the level.
+ *
  * @see BasePatchLevel
  * @see Patch
  * @see PatchDescriptor
@@ -309,6 +319,35 @@ public:
       return static_cast<int>(d_box_level->getLocalNumberOfCells());
    }
 
+   /*!
+    * @brief Get the number of bytes of patch metadata held locally.
+    *
+    * This counts the Patch and PatchGeometry objects of the local patches,
+    * their boundary boxes and patch data pointer arrays, and the level's
+    * patch container.  Patch data storage is not included.
+    */
+   size_t
+   getLocalMetadataBytes() const;
+
+   /*!
+    * @brief Apply an operation to the tiles of all local patches.
+    *
+    * This is the level-wide form of Patch::processTiles().  The tiles of
+    * all local patches are gathered into a single loop, so that when
+    * SAMRAI is built with OpenMP the threads are shared by many small
+    * patches as well as by a few large ones.
+    *
+    * @param[in,out] strategy  Operation applied to each tile.
+    * @param[in] tile_size     Maximum tile width in each direction; a zero
+    *                          component leaves that direction unsplit.
+    *
+    * @pre getDim() == tile_size.getDim()
+    */
+   void
+   processTiles(
+      PatchTileStrategy& strategy,
+      const IntVector& tile_size);
+
    /*!
     * @brief Get the global number of cells
     */
@@ -330,13 +369,13 @@ public:
       const GlobalId& gid) const
    {
       BoxId mbid(gid);
-      PatchContainer::const_iterator it = d_patches.find(mbid);
-      if (it == d_patches.end()) {
+      const int index = findPatchIndex(mbid);
+      if (index < 0) {
          TBOX_ERROR("PatchLevel::getPatch error: GlobalId "
             << gid << " does not exist locally.\n"
             << "You must specify the GlobalId of a current local patch.");
       }
-      return it->second;
+      return d_patch_vector[index];
    }
 
    /*!
@@ -346,20 +385,20 @@ public:
     *
     * @return A std::shared_ptr to the Patch indicated by the BoxId.
     *
-    * @pre d_patches.find(mbid) != d_patches.end()
+    * @pre a local patch with BoxId mbid exists
     */
    std::shared_ptr<Patch>
    getPatch(
       const BoxId& mbid) const
    {
-      const PatchContainer::const_iterator mi = d_patches.find(mbid);
-      if (mi == d_patches.end()) {
+      const int index = findPatchIndex(mbid);
+      if (index < 0) {
          TBOX_ERROR("PatchLevel::getPatch error: BoxId "
             << mbid << " does not exist locally.\n"
             << "You must specify the BoxId of a current local box"
             << " that is not a periodic image.");
       }
-      return (*mi).second;
+      return d_patch_vector[index];
    }
 
    /*!
@@ -791,9 +830,9 @@ public:
       const int id) const
    {
       bool allocated = true;
-      for (PatchContainer::const_iterator mi = d_patches.begin();
-           mi != d_patches.end(); ++mi) {
-         allocated &= (*mi).second->checkAllocated(id);
+      for (PatchVector::const_iterator mi = d_patch_vector.begin();
+           mi != d_patch_vector.end(); ++mi) {
+         allocated &= (*mi)->checkAllocated(id);
       }
       return allocated;
    }
@@ -1125,12 +1164,7 @@ private:
    static const int HIER_PATCH_LEVEL_VERSION;
 
    /*
-    * @brief Container of distributed patches on level.
-    */
-   typedef std::map<BoxId, std::shared_ptr<Patch> > PatchContainer;
-
-   /*
-    * @brief Vector of local patches on level.
+    * @brief Vector of local patches on level, sorted by BoxId.
     */
    typedef std::vector<std::shared_ptr<Patch> > PatchVector;
 
@@ -1169,7 +1203,7 @@ public:
       const std::shared_ptr<Patch>&
       operator * () const
       {
-         return d_iterator->second;
+         return *d_iterator;
       }
 
       /*!
@@ -1178,7 +1212,7 @@ public:
       const std::shared_ptr<Patch>&
       operator -> () const
       {
-         return d_iterator->second;
+         return *d_iterator;
       }
 
       /*!
@@ -1242,12 +1276,12 @@ private:
       /*!
        * @brief The real iterator (this class is basically a wrapper).
        */
-      PatchContainer::const_iterator d_iterator;
+      PatchVector::const_iterator d_iterator;
 
       /*!
        * @brief For supporting backward-compatible interface.
        */
-      const PatchContainer* d_patches;
+      const PatchVector* d_patches;
 
    };
 
@@ -1296,6 +1330,41 @@ private:
    void
    initializeGlobalizedBoxLevel() const;
 
+   /*!
+    * @brief Allocate the patches for the local boxes of d_box_level
+    * through the patch factory in a single batch.
+    */
+   void
+   allocatePatches();
+
+   /*!
+    * @brief Return the position of the local patch with the given BoxId
+    * in d_patch_vector, or -1 if there is no such patch.
+    */
+   int
+   findPatchIndex(
+      const BoxId& box_id) const
+   {
+      PatchVector::const_iterator pi =
+         std::lower_bound(d_patch_vector.begin(), d_patch_vector.end(),
+            box_id, patchBoxIdLessThan);
+      if (pi == d_patch_vector.end() || (*pi)->getBox().getBoxId() != box_id) {
+         return -1;
+      }
+      return static_cast<int>(pi - d_patch_vector.begin());
+   }
+
+   /*!
+    * @brief Order patches by BoxId for findPatchIndex().
+    */
+   static bool
+   patchBoxIdLessThan(
+      const std::shared_ptr<Patch>& patch,
+      const BoxId& box_id)
+   {
+      return patch->getBox().getBoxId() < box_id;
+   }
+
    /*!
     * @brief Dimension of the object
     */
@@ -1384,15 +1453,13 @@ private:
     */
    bool d_in_hierarchy;
 
-   /*
-    * Container for patches.
-    */
-   PatchContainer d_patches;
-
    /*!
-    * @brief Vector holding the same patches in d_patches, in the same order.
+    * @brief Local patches, sorted by BoxId.
     *
-    * This allows random access to the patches.
+    * This allows random access to the patches and lookup by BoxId with a
+    * binary search.  When the level uses the standard PatchFactory, the
+    * Patch objects themselves are held in one PatchArena shared by all
+    * of these pointers.
     */
    PatchVector d_patch_vector;
 
@@ -0,0 +1,71 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2018 Lawrence Livermore National Security, LLC
+ * Description:   Strategy interface for operations on patch tiles
+ *
+ ************************************************************************/
+
+#ifndef included_hier_PatchTileStrategy
+#define included_hier_PatchTileStrategy
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/Box.h"
+
+namespace SAMRAI {
+namespace hier {
+
+class Patch;
+
+/*!
+ * @brief Class PatchTileStrategy is the interface for a user operation
+ * applied to the tiles of a patch by Patch::processTiles() and
+ * PatchLevel::processTiles().
+ *
+ * When SAMRAI is built with OpenMP, tiles are processed concurrently, so
+ * processTile() must be safe to call from several threads at once.  In
+ * particular, it should write only to the cells of the given tile and
+ * must not allocate or deallocate patch data.
+ *
+ * @see BoxTiling
+ */
+class PatchTileStrategy
+{
+public:
+   /*!
+    * @brief Constructor.
+    */
+   PatchTileStrategy();
+
+   /*!
+    * @brief Virtual destructor.
+    */
+   virtual ~PatchTileStrategy();
+
+   /*!
+    * @brief Apply the operation to one tile of a patch.
+    *
+    * @param[in,out] patch  The patch the tile belongs to.
+    * @param[in] tile_box   The tile, a sub-box of the patch box.
+    */
+   virtual void
+   processTile(
+      Patch& patch,
+      const Box& tile_box) = 0;
+
+private:
+   // The following are not implemented.
+   PatchTileStrategy(
+      const PatchTileStrategy&);
+   PatchTileStrategy&
+   operator = (
+      const PatchTileStrategy&);
+};
+
+}
+}
+
+#endif
@@ -21,6 +21,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 namespace SAMRAI {
 namespace hier {
@@ -65,6 +66,32 @@ namespace hier {
 class RefineOperator
 {
 public:
+   /*!
+    * @brief One refinement in a batch passed to refineBatch().
+    *
+    * A work item names the fine and coarse patches, the overlap on the
+    * fine patch over which to refine and the refinement ratio between
+    * the patches.  The item does not own the objects it points to.
+    */
+   struct WorkItem {
+      WorkItem(
+         Patch& fine,
+         const Patch& coarse,
+         const BoxOverlap& fine_overlap,
+         const IntVector& ratio):
+         d_fine(&fine),
+         d_coarse(&coarse),
+         d_fine_overlap(&fine_overlap),
+         d_ratio(ratio)
+      {
+      }
+
+      Patch* d_fine;
+      const Patch* d_coarse;
+      const BoxOverlap* d_fine_overlap;
+      IntVector d_ratio;
+   };
+
    /*!
     * @brief Construct the object with a name to allow the
     * TransferOperatorRegistry class to look up the object using a
@@ -73,9 +100,18 @@ public:
     * The constructor must be given a name.  The object will be
     * registered under this name with the TransferOperatorRegistry class.
     * The name must be unique, as duplicate names are not allowed.
+    *
+    * An operator whose refine() may be called concurrently for work items
+    * on different fine patches passes true for threaded_batch.  The
+    * default refineBatch() then dispatches the items of a batch over the
+    * OpenMP threads.
+    *
+    * @param[in] name
+    * @param[in] threaded_batch
     */
    RefineOperator(
-      const std::string& name);
+      const std::string& name,
+      bool threaded_batch = false);
 
    /**
     * The virtual destructor for the refinement operator does
@@ -129,6 +165,35 @@ public:
       const BoxOverlap& fine_overlap,
       const IntVector& ratio) const = 0;
 
+   /*!
+    * @brief Refine the source component to the destination component for
+    * every work item in a batch.
+    *
+    * The communication schedules collect the refinements of a level for
+    * one operator and pass them here in a single call.  The default
+    * implementation calls refine() on each work item.  If the operator was
+    * constructed with threaded_batch, work items that share a fine patch
+    * are processed in their batch order by one thread, and different fine
+    * patches run concurrently when OpenMP is enabled.  Otherwise the items
+    * are processed in order.
+    *
+    * The default implementation only dispatches the work items: each item
+    * still goes through refine(), so per-item setup such as the patch data
+    * casts, patch geometry lookups and array bounds is not shared between
+    * items.  Operators that can share such setup across a batch should
+    * override this method to do so.
+    *
+    * @param[in] items  Work items, in the order a serial fill would
+    *                   process them
+    * @param[in] dst_component  Patch data index on the fine patches
+    * @param[in] src_component  Patch data index on the coarse patches
+    */
+   virtual void
+   refineBatch(
+      const std::vector<WorkItem>& items,
+      const int dst_component,
+      const int src_component) const;
+
    /*!
     * @brief Get the max stencil width of all refine operators.
     *
@@ -146,6 +211,27 @@ private:
    operator = (
       const RefineOperator&);                           // not implemented
 
+   /*!
+    * @brief Refine a batch of work items, running items on different fine
+    * patches concurrently when OpenMP is enabled.
+    *
+    * Work items that share a fine patch are refined in their batch order
+    * by a single thread, so overlapping destination regions are written
+    * in the same order as by a serial fill.
+    *
+    * This is a threaded dispatch of refine() over the items: it calls
+    * refine() once per item and adds no batched computation of its own.
+    *
+    * @param[in] items
+    * @param[in] dst_component
+    * @param[in] src_component
+    */
+   void
+   refineBatchThreaded(
+      const std::vector<WorkItem>& items,
+      const int dst_component,
+      const int src_component) const;
+
    /*
     * TODO SGS Rich has better way of doing this.
     */
@@ -183,6 +269,11 @@ private:
 
    const std::string d_name;
 
+   /*!
+    * @brief Whether refineBatch() may run work items concurrently.
+    */
+   const bool d_threaded_batch;
+
    static std::multimap<std::string, RefineOperator *> s_lookup_table;
    static TBOX_omp_lock_t l_lookup_table;
 
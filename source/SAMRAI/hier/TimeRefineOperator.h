@@ -0,0 +1,132 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2018 Lawrence Livermore National Security, LLC
+ * Description:   Abstract base class for fused time interpolation and
+ *                spatial refinement operators.
+ *
+ ************************************************************************/
+
+#ifndef included_hier_TimeRefineOperator
+#define included_hier_TimeRefineOperator
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/BoxOverlap.h"
+#include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/hier/Patch.h"
+
+#include <string>
+
+namespace SAMRAI {
+namespace hier {
+
+/**
+ * Class TimeRefineOperator is an abstract base class for operators that
+ * fuse a time interpolation operator with a spatial refinement operator.
+ * A fused operator reads old and new data on a coarse patch and writes
+ * refined data on a fine patch in one pass, producing the same result as
+ * time interpolating the coarse data into a temporary and refining the
+ * temporary.
+ *
+ * A fused operator stands in for exactly one pair of operators, named by
+ * getRefineOperatorName() and getTimeInterpolateOperatorName().  It is
+ * optional: the transfer routines use it only where the coarse data to be
+ * refined lies entirely in the interior of one local coarse patch (see
+ * xfer::RefineAlgorithm::registerRefine()), and use the separate operators
+ * everywhere else.
+ *
+ * To add a new fused operator, define it by inheriting from this abstract
+ * base class and add it to the operator list for the appropriate transfer
+ * geometry object using the BaseGridGeometry::addTimeRefineOperator()
+ * function.
+ *
+ * @see TransferOperatorRegistry
+ * @see RefineOperator
+ * @see TimeInterpolateOperator
+ */
+
+class TimeRefineOperator
+{
+public:
+   /*!
+    * @brief Construct the object with the names of the operators it fuses.
+    *
+    * @param[in] refine_op_name  Name of the fused refinement operator.
+    * @param[in] time_op_name    Name of the fused time interpolation
+    *                            operator.
+    */
+   TimeRefineOperator(
+      const std::string& refine_op_name,
+      const std::string& time_op_name = "STD_LINEAR_TIME_INTERPOLATE");
+
+   /**
+    * The virtual destructor for the fused operator does nothing
+    * interesting.
+    */
+   virtual ~TimeRefineOperator();
+
+   /**
+    * Return the name of the refinement operator this operator fuses.
+    */
+   const std::string&
+   getRefineOperatorName() const
+   {
+      return d_refine_op_name;
+   }
+
+   /**
+    * Return the name of the time interpolation operator this operator
+    * fuses.
+    */
+   const std::string&
+   getTimeInterpolateOperatorName() const
+   {
+      return d_time_op_name;
+   }
+
+   /**
+    * Return the stencil width of the operator, which must equal that of
+    * the fused refinement operator.
+    */
+   virtual IntVector
+   getStencilWidth(
+      const tbox::Dimension& dim) const = 0;
+
+   /**
+    * Time interpolate the old and new source components on the coarse
+    * patch to fill_time and refine the result to the destination component
+    * on the fine patch.  The operation is performed on the intersection of
+    * the destination patch and the boxes contained in fine_overlap.  The
+    * interiors of the old and new coarse data are guaranteed to cover the
+    * stencil width of the operator.  As in the unfused transfer, if the time
+    * of the old data equals fill_time the new data is not read.
+    */
+   virtual void
+   refine(
+      Patch& fine,
+      const Patch& coarse,
+      const int dst_component,
+      const int src_told_component,
+      const int src_tnew_component,
+      const double fill_time,
+      const BoxOverlap& fine_overlap,
+      const IntVector& ratio) const = 0;
+
+private:
+   // Neither of these is implemented.
+   TimeRefineOperator(
+      const TimeRefineOperator&);
+   TimeRefineOperator&
+   operator = (
+      const TimeRefineOperator&);
+
+   const std::string d_refine_op_name;
+   const std::string d_time_op_name;
+};
+
+}
+}
+#endif
@@ -16,6 +16,7 @@
 #include "SAMRAI/hier/CoarsenOperator.h"
 #include "SAMRAI/hier/RefineOperator.h"
 #include "SAMRAI/hier/TimeInterpolateOperator.h"
+#include "SAMRAI/hier/TimeRefineOperator.h"
 #include "SAMRAI/hier/IntVector.h"
 #include "SAMRAI/hier/Variable.h"
 #include "SAMRAI/tbox/Dimension.h"
@@ -116,6 +117,23 @@ public:
       const char* var_type_name,
       const std::shared_ptr<TimeInterpolateOperator>& time_op);
 
+   /*!
+    * @brief Add a concrete fused time interpolation and refinement
+    * operator.
+    *
+    * At most one fused operator is kept for each variable type and pair of
+    * fused operator names; adding another replaces it.
+    *
+    * @param[in]  var_type_name The type name of the variable with which
+    *             time_refine_op is associated
+    * @param[in]  time_refine_op The concrete fused operator to add to the
+    *             lookup hash map.
+    */
+   void
+   addTimeRefineOperator(
+      const char* var_type_name,
+      const std::shared_ptr<TimeRefineOperator>& time_refine_op);
+
    /*!
     * @brief Lookup function for coarsening operator.
     *
@@ -178,6 +196,33 @@ public:
       const std::string& op_name =
          "STD_LINEAR_TIME_INTERPOLATE");
 
+   /*!
+    * @brief Lookup function for fused time interpolation and refinement
+    * operator.
+    *
+    * Extract the operator fusing the named refinement and time
+    * interpolation operators for the given variable from the hash map.
+    * Since fused operators are optional, a null pointer is returned if
+    * there is no match.
+    *
+    * @param[in]  var The Variable for which the corresponding fused
+    *                 operator should match.
+    * @param[in]  refine_op_name The string identifier of the fused
+    *                            refinement operator.
+    * @param[in]  time_op_name The string identifier of the fused time
+    *                          interpolation operator.
+    *                          \b Default: STD_LINEAR_TIME_INTERPOLATE
+    *
+    * @pre var
+    * @pre getMinTransferOpStencilWidth().getDim() == var->getDim()
+    */
+   std::shared_ptr<TimeRefineOperator>
+   lookupTimeRefineOperator(
+      const std::shared_ptr<Variable>& var,
+      const std::string& refine_op_name,
+      const std::string& time_op_name =
+         "STD_LINEAR_TIME_INTERPOLATE");
+
    /*!
     * @brief Get the max stencil width of all transfer operators.
     *
@@ -232,7 +277,8 @@ public:
    {
       return !d_refine_operators.empty() ||
              !d_coarsen_operators.empty() ||
-             !d_time_operators.empty();
+             !d_time_operators.empty() ||
+             !d_time_refine_operators.empty();
    }
 
    /*!
@@ -281,6 +327,17 @@ private:
                                                           std::shared_ptr<TimeInterpolateOperator> > >
    d_time_operators;
 
+   /*
+    * The hash map of fused time interpolation and refinement operators,
+    * keyed by the name of the fused refinement operator followed by the
+    * name of the fused time interpolation operator, and then by variable
+    * type name.  Fused operators are optional (see addTimeRefineOperator()
+    * function).
+    */
+   std::unordered_map<std::string, std::unordered_map<std::string,
+                                                          std::shared_ptr<TimeRefineOperator> > >
+   d_time_refine_operators;
+
    /*!
     * @brief Value set by setMinTransferOpStencilWidth().
     */
@@ -153,6 +153,13 @@ private:
    const PatchHierarchy* d_hierarchy;
    const FlattenedHierarchy* d_flattened_hierarchy;
 
+   /*
+    * The hierarchy's cached FlattenedHierarchy when iterating over a
+    * PatchHierarchy.  Holding it keeps d_flattened_hierarchy valid if the
+    * hierarchy drops it from its cache, and lets copies share it.
+    */
+   std::shared_ptr<const FlattenedHierarchy> d_shared_flattened_hierarchy;
+
    bool d_allocated_flattened_hierarchy;
 
    /* The current level in the PatchHierarchy. */
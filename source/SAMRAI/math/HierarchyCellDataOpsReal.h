@@ -622,6 +622,67 @@ public:
       const int denom_id,
       bool local_only = false) const;
 
+   /**
+    * Return discrete \f$L_1\f$-norm of the data over the composite grid.
+    * Only the regions of each patch not covered by a finer level in the
+    * range of levels are visited, as given by the hierarchy's cached
+    * hier::FlattenedHierarchy, so no control volume array is required.
+    * Each cell is weighted by level_zero_cell_volume divided by the
+    * product of its level's ratio to level zero.  If local_only is true,
+    * the global reduction is not performed.
+    *
+    * @pre getPatchHierarchy()
+    * @pre (d_coarsest_level >= 0) && (d_finest_level >= d_coarsest_level) &&
+    *      (d_finest_level <= getPatchHierarchy()->getFinestLevelNumber())
+    */
+   double
+   compositeL1Norm(
+      const int data_id,
+      const double level_zero_cell_volume = 1.0,
+      bool local_only = false) const;
+
+   /**
+    * Return discrete \f$L_2\f$-norm of the data over the composite grid.
+    * Cells are visited and weighted as in compositeL1Norm().
+    *
+    * @pre getPatchHierarchy()
+    * @pre (d_coarsest_level >= 0) && (d_finest_level >= d_coarsest_level) &&
+    *      (d_finest_level <= getPatchHierarchy()->getFinestLevelNumber())
+    */
+   double
+   compositeL2Norm(
+      const int data_id,
+      const double level_zero_cell_volume = 1.0,
+      bool local_only = false) const;
+
+   /**
+    * Return the \f$\max\f$-norm of the data over the composite grid,
+    * visiting only cells not covered by a finer level.
+    *
+    * @pre getPatchHierarchy()
+    * @pre (d_coarsest_level >= 0) && (d_finest_level >= d_coarsest_level) &&
+    *      (d_finest_level <= getPatchHierarchy()->getFinestLevelNumber())
+    */
+   double
+   compositeMaxNorm(
+      const int data_id,
+      bool local_only = false) const;
+
+   /**
+    * Return the dot product of the two data arrays over the composite grid.
+    * Cells are visited and weighted as in compositeL1Norm().
+    *
+    * @pre getPatchHierarchy()
+    * @pre (d_coarsest_level >= 0) && (d_finest_level >= d_coarsest_level) &&
+    *      (d_finest_level <= getPatchHierarchy()->getFinestLevelNumber())
+    */
+   TYPE
+   compositeDot(
+      const int data1_id,
+      const int data2_id,
+      const double level_zero_cell_volume = 1.0,
+      bool local_only = false) const;
+
 private:
    // The following are not implemented
    HierarchyCellDataOpsReal(
@@ -630,6 +691,15 @@ private:
    operator = (
       const HierarchyCellDataOpsReal&);
 
+   /*
+    * Return the volume of a cell of the given patch, computed from the
+    * volume of a level zero cell and the patch level's ratio to level zero.
+    */
+   static double
+   getCompositeCellVolume(
+      const hier::Patch& patch,
+      const double level_zero_cell_volume);
+
    std::shared_ptr<hier::PatchHierarchy> d_hierarchy;
    int d_coarsest_level;
    int d_finest_level;
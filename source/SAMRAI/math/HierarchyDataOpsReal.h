@@ -464,6 +464,62 @@ public:
       const int denom_id,
       bool local_only = false) const = 0;
 
+   /*!
+    * @brief Return the discrete \f$L_1\f$-norm of the data over the
+    * composite grid.
+    *
+    * Only cells not covered by a finer level in the range of levels are
+    * visited, so no control volume array is needed.  Each cell is weighted
+    * by level_zero_cell_volume divided by the product of its level's ratio
+    * to level zero, which matches a control volume array for grids whose
+    * cell volumes scale with the refinement ratio (e.g., Cartesian grids).
+    * If local_only is true, the global reduction is not performed.
+    *
+    * The default implementation is an unrecoverable error; subclasses that
+    * support composite-grid reductions override it.
+    */
+   virtual double
+   compositeL1Norm(
+      const int data_id,
+      const double level_zero_cell_volume = 1.0,
+      bool local_only = false) const;
+
+   /*!
+    * @brief Return the discrete \f$L_2\f$-norm of the data over the
+    * composite grid.
+    *
+    * Cells are visited and weighted as in compositeL1Norm().
+    */
+   virtual double
+   compositeL2Norm(
+      const int data_id,
+      const double level_zero_cell_volume = 1.0,
+      bool local_only = false) const;
+
+   /*!
+    * @brief Return the \f$\max\f$-norm of the data over the composite grid.
+    *
+    * Only cells not covered by a finer level in the range of levels are
+    * visited.
+    */
+   virtual double
+   compositeMaxNorm(
+      const int data_id,
+      bool local_only = false) const;
+
+   /*!
+    * @brief Return the dot product of two data arrays over the composite
+    * grid.
+    *
+    * Cells are visited and weighted as in compositeL1Norm().
+    */
+   virtual TYPE
+   compositeDot(
+      const int data1_id,
+      const int data2_id,
+      const double level_zero_cell_volume = 1.0,
+      bool local_only = false) const;
+
 private:
    // The following are not implemented
    HierarchyDataOpsReal(
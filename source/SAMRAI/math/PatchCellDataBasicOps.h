@@ -236,6 +236,36 @@ public:
       const hier::Box& box) const;
 
 private:
+   /*
+    * Elementwise operations applied by applyOverTiles().
+    */
+   enum TileOperation { SCALE,
+                        ADD_SCALAR,
+                        ADD,
+                        SUBTRACT,
+                        MULTIPLY,
+                        DIVIDE,
+                        RECIPROCAL,
+                        LINEAR_SUM,
+                        AXPY,
+                        AXMY };
+
+   /*
+    * Apply the operation of ArrayDataBasicOps named by operation to the
+    * box tile by tile, sharing the tiles among threads.  Operations with
+    * one source use only src1, and those without scalars ignore alpha
+    * and beta.
+    */
+   void
+   applyOverTiles(
+      TileOperation operation,
+      pdat::ArrayData<TYPE>& dst,
+      const pdat::ArrayData<TYPE>& src1,
+      const pdat::ArrayData<TYPE>& src2,
+      const TYPE& alpha,
+      const TYPE& beta,
+      const hier::Box& box) const;
+
    // The following are not implemented:
    PatchCellDataBasicOps(
       const PatchCellDataBasicOps&);
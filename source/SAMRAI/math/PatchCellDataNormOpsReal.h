@@ -237,6 +237,28 @@ public:
       const std::shared_ptr<pdat::CellData<double> >& vol) const;
 
 private:
+   /*
+    * Norms and inner products computed by reduceOverTiles().
+    */
+   enum TileReduction { L1_NORM,
+                        MAX_NORM,
+                        DOT };
+
+   /*
+    * Compute the operation of ArrayDataNormOpsReal named by reduction on
+    * the box tile by tile, sharing the tiles among threads, and combine
+    * the tile results in tile order.  Only DOT uses data2.  The control
+    * volume variant of the operation is used if cvol is non-null.
+    */
+   template<class RESULT>
+   RESULT
+   reduceOverTiles(
+      TileReduction reduction,
+      const pdat::ArrayData<TYPE>& data1,
+      const pdat::ArrayData<TYPE>& data2,
+      const pdat::ArrayData<double>* cvol,
+      const hier::Box& box) const;
+
    // The following are not implemented:
    PatchCellDataNormOpsReal(
       const PatchCellDataNormOpsReal&);
@@ -16,15 +16,20 @@
 #include "SAMRAI/hier/BaseGridGeometry.h"
 #include "SAMRAI/hier/Connector.h"
 #include "SAMRAI/hier/MappingConnector.h"
+#include "SAMRAI/hier/PatchHierarchy.h"
 #include "SAMRAI/hier/PatchLevel.h"
 #include "SAMRAI/hier/ProcessorMapping.h"
 #include "SAMRAI/math/PatchCellDataNormOpsReal.h"
 #include "SAMRAI/mesh/PartitioningParams.h"
 #include "SAMRAI/mesh/SpatialKey.h"
+#include "SAMRAI/tbox/MessageStream.h"
 #include "SAMRAI/tbox/RankGroup.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
 
 #include <iostream>
 #include <list>
+#include <map>
+#include <memory>
 #include <vector>
 
 namespace SAMRAI {
@@ -326,6 +331,76 @@ struct BalanceUtilities {
       int wrk_indx,
       const hier::Box& box);
 
+   /*!
+    * @brief Create a PatchLevel on the boxes being balanced, holding
+    * the workload data of the current level of the hierarchy.
+    *
+    * The returned level has the same boxes as balance_box_level.  Its
+    * workload data is filled from level level_number of the hierarchy,
+    * so patch workloads of the unbalanced boxes can be computed with
+    * computeNonUniformWorkload().
+    *
+    * @param[in] balance_box_level  Boxes being balanced.
+    * @param[in] balance_to_reference  Connector from balance_box_level
+    *                                  to the reference level, with transpose.
+    * @param[in] hierarchy
+    * @param[in] level_number  Level being balanced.
+    * @param[in] wrk_indx  Patch data identifier for work data.
+    *
+    * @pre hierarchy
+    * @pre balance_to_reference.hasTranspose()
+    * @pre hierarchy->getNumberOfLevels() > level_number
+    */
+   static std::shared_ptr<hier::PatchLevel>
+   createWorkloadLevel(
+      const hier::BoxLevel& balance_box_level,
+      hier::Connector& balance_to_reference,
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      int level_number,
+      int wrk_indx);
+
+   /*!
+    * @brief Create a PatchLevel on the boxes being balanced, holding
+    * several cell-centered load data of the current level of the
+    * hierarchy (e.g., compute workload and memory).
+    *
+    * This is the same as the single-index version, except that all data
+    * in wrk_indices are allocated and filled.
+    *
+    * @pre hierarchy
+    * @pre balance_to_reference.hasTranspose()
+    * @pre hierarchy->getNumberOfLevels() > level_number
+    * @pre !wrk_indices.empty()
+    */
+   static std::shared_ptr<hier::PatchLevel>
+   createWorkloadLevel(
+      const hier::BoxLevel& balance_box_level,
+      hier::Connector& balance_to_reference,
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      int level_number,
+      const std::vector<int>& wrk_indices);
+
+   /*!
+    * @brief Fill cell-centered data on a patch with the memory, in
+    * bytes per cell, of the patch data allocated on the patch.
+    *
+    * The memory of each allocated component (other than mem_indx) is
+    * measured as the stream size of the data over its ghost box, so it
+    * includes ghost cells and the items held by variable-size data such
+    * as IndexData, and is spread evenly over the cells of the patch.
+    * The data is allocated if needed.  The result is suitable as the
+    * memory load of
+    * CascadePartitioner::setMemoryPatchDataIndex().
+    *
+    * @param patch     Patch to measure.
+    * @param mem_indx  Patch data identifier for the memory data, which
+    *                  must be cell-centered double data.
+    */
+   static void
+   fillMemoryLoad(
+      hier::Patch& patch,
+      int mem_indx);
+
    /*!
     * @brief Find small boxes in a post-balance BoxLevel that are not
     * in a pre-balance BoxLevel.
@@ -488,6 +563,31 @@ struct BalanceUtilities {
       hier::Connector* balance_to_anchor,
       const tbox::RankGroup& rank_group);
 
+   /*!
+    * @brief Send a message to each process in send_streams and receive
+    * the messages sent to this process, without knowing the senders.
+    *
+    * The cost does not grow with the number of processes in @c mpi, as
+    * an exchange of message sizes between all processes would.  All
+    * processes in @c mpi must call this method.  Consecutive exchanges
+    * must use different tags, because a process may start the next
+    * exchange while others are still receiving.
+    *
+    * @param[out] recv_buffers  Received messages, by sender.
+    * @param[in] send_streams  Messages to send, by receiver.  A message
+    * to the local process is copied to recv_buffers.
+    * @param[in] tag
+    * @param[in] mpi
+    *
+    * @pre each stream in send_streams is not empty
+    */
+   static void
+   exchangeSparse(
+      std::map<int, std::vector<char> >& recv_buffers,
+      const std::map<int, std::shared_ptr<tbox::MessageStream> >& send_streams,
+      int tag,
+      const tbox::SAMRAI_MPI& mpi);
+
 private:
    struct RankAndLoad {
       int rank;
@@ -50,6 +50,17 @@ namespace mesh {
  * The default behavior of this class is to do uniform load balancing, treating
  * all cells of a level as having equal load value.
  *
+ * Non-uniform load balancing can be subject to a memory constraint.
+ * Calling setMemoryPatchDataIndex() gives this object a second
+ * cell-centered data holding memory per cell (see
+ * BalanceUtilities::fillMemoryLoad()).  The partition is first
+ * balanced for the workload alone.  If the largest memory of a
+ * process exceeds the limit, the level is repartitioned balancing the
+ * workload plus a multiple of the memory, with the multiple starting
+ * where the two have equal totals and doubling until the limit is met
+ * or max_constraint_iterations is reached.  Stopping at the first
+ * multiple that meets the limit keeps the workload close to balanced.
+ *
  * <b> Input Parameters </b>
  *
  * <b> Definitions: </b>
@@ -79,6 +90,17 @@ namespace mesh {
  *   load balancing always uses the voucher method regardless of this
  *   parameter's value.
  *
+ *   - \b max_memory_load
+ *   Largest memory a process may have, in the units of the memory data.
+ *   If not given (or zero), the limit is set by memory_imbalance_tolerance.
+ *
+ *   - \b memory_imbalance_tolerance
+ *   When max_memory_load is not given, the largest memory a process may
+ *   have is (1 + memory_imbalance_tolerance) times the average.
+ *
+ *   - \b max_constraint_iterations
+ *   Largest number of repartitionings to meet the memory limit.
+ *
  * <b> Details: </b> <br>
  * <table>
  *   <tr>
@@ -121,6 +143,30 @@ namespace mesh {
  *     <td>opt</td>
  *     <td>Not written to restart. Value in input db used.</td>
  *   </tr>
+ *   <tr>
+ *     <td>max_memory_load</td>
+ *     <td>double</td>
+ *     <td>0 (none)</td>
+ *     <td> >= 0</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>memory_imbalance_tolerance</td>
+ *     <td>double</td>
+ *     <td>0.25</td>
+ *     <td> >= 0</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>max_constraint_iterations</td>
+ *     <td>int</td>
+ *     <td>4</td>
+ *     <td> >= 0</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
  * </table>
  *
  * @internal The following are developer inputs.  Defaults listed
@@ -273,6 +319,30 @@ public:
       int data_id,
       int level_number = -1);
 
+   /*!
+    * @brief Configure the load balancer to limit the memory of each
+    * process, using the data stored in the hierarchy at the specified
+    * descriptor index for the memory of each cell.
+    *
+    * The memory constraint is applied only to levels balanced with a
+    * workload data id (see setWorkloadPatchDataIndex()).
+    *
+    * @param data_id
+    * Integer value of patch data identifier for memory per cell.  An
+    * invalid value (i.e., < 0) turns the memory constraint off.
+    *
+    * @param level_number
+    * Optional integer number for level on which data id
+    * is used.  If no value is given, the data will be
+    * used for all levels.
+    *
+    * @pre data_id < 0 || hier::VariableDatabase::getDatabase()->getPatchDescriptor()->getPatchDataFactory(data_id) is actually a  std::shared_ptr<pdat::CellDataFactory<double> >
+    */
+   void
+   setMemoryPatchDataIndex(
+      int data_id,
+      int level_number = -1);
+
    /*!
     * @brief Return true if load balancing procedure for given level
     * depends on patch data on mesh; otherwise return false.
@@ -331,6 +401,16 @@ private:
              d_master_workload_data_id;
    }
 
+   int
+   getMemoryDataId(
+      int level_number) const
+   {
+      TBOX_ASSERT(level_number >= 0);
+      return level_number < static_cast<int>(d_memory_data_id.size()) ?
+             d_memory_data_id[level_number] :
+             d_master_memory_data_id;
+   }
+
    /*
     * Count the local workload.
     */
@@ -343,7 +423,33 @@ private:
     */
    LoadType
    computeNonUniformWorkLoad(
-      const hier::PatchLevel& patch_level) const;
+      const hier::PatchLevel& patch_level,
+      int data_id) const;
+
+   /*!
+    * @brief Repartition balance_box_level by the workload data of the
+    * hierarchy plus memory_weight times its memory data.
+    */
+   void
+   partitionNonUniform(
+      hier::BoxLevel& balance_box_level,
+      hier::Connector* balance_to_reference,
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      int level_number,
+      const tbox::RankGroup& rank_group,
+      double memory_weight) const;
+
+   /*!
+    * @brief Repartition by the workload, then by workload and memory as
+    * needed to meet the memory limit.
+    */
+   void
+   partitionWithMemoryConstraint(
+      hier::BoxLevel& balance_box_level,
+      hier::Connector* balance_to_reference,
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      int level_number,
+      const tbox::RankGroup& rank_group) const;
 
    /*!
     * *@brief Implements the cascade partitioner algorithm.
@@ -412,6 +518,28 @@ private:
 
    int d_master_workload_data_id;
 
+   /*
+    * Memory data ids, analogous to the workload data ids.
+    */
+   std::vector<int> d_memory_data_id;
+
+   int d_master_memory_data_id;
+
+   /*!
+    * @brief Internal data holding workload plus weighted memory on the
+    * workload level.  Registered by setMemoryPatchDataIndex().
+    */
+   int d_combined_load_data_id;
+
+   //! @brief See input parameter "max_memory_load".
+   double d_max_memory_load;
+
+   //! @brief See input parameter "memory_imbalance_tolerance".
+   double d_memory_imbalance_tol;
+
+   //! @brief See input parameter "max_constraint_iterations".
+   int d_max_constraint_iterations;
+
    /*!
     * @brief Tile size, when restricting cuts to tile boundaries,
     * Set to 1 when not restricting.
@@ -463,6 +591,11 @@ private:
     */
    mutable std::shared_ptr<hier::PatchLevel> d_workload_level;
 
+   /*!
+    * @brief Data id of the load being balanced on d_workload_level.
+    */
+   mutable int d_balance_data_id;
+
    //@{
    //! @name Shared temporaries, used only when actively partitioning.
    mutable hier::BoxLevel* d_balance_box_level;
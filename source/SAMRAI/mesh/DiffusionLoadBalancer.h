@@ -0,0 +1,517 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2018 Lawrence Livermore National Security, LLC
+ * Description:   Incremental load balancer using diffusion between
+ *                neighboring processes.
+ *
+ ************************************************************************/
+
+#ifndef included_mesh_DiffusionLoadBalancer
+#define included_mesh_DiffusionLoadBalancer
+
+#include "SAMRAI/SAMRAI_config.h"
+#include "SAMRAI/mesh/LoadBalanceStrategy.h"
+#include "SAMRAI/mesh/PartitioningParams.h"
+#include "SAMRAI/hier/MappingConnector.h"
+#include "SAMRAI/hier/PatchLevel.h"
+#include "SAMRAI/tbox/AsyncCommPeer.h"
+#include "SAMRAI/tbox/AsyncCommStage.h"
+#include "SAMRAI/tbox/Database.h"
+#include "SAMRAI/tbox/MessageStream.h"
+#include "SAMRAI/tbox/RankGroup.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+#include "SAMRAI/tbox/Timer.h"
+#include "SAMRAI/tbox/Utilities.h"
+
+#include <iostream>
+#include <vector>
+#include <memory>
+
+namespace SAMRAI {
+namespace mesh {
+
+/*!
+ * @brief Incremental load balancer that starts from the current
+ * ownership of the boxes and diffuses work between neighboring
+ * processes until the imbalance falls below a tolerance.
+ *
+ * Partitioners such as TreeLoadBalancer and CascadePartitioner compute
+ * a new distribution without regard to where the boxes currently are.
+ * This balancer instead keeps boxes with the process that owns them in
+ * the BoxLevel passed to loadBalanceBoxLevel() and only shifts work off
+ * overloaded processes, which keeps the number of boxes changing owner
+ * small when that BoxLevel is already nearly balanced.
+ *
+ * When regridding, the BoxLevel given is the box generator's output,
+ * whose owners need not hold the old level's data.  If a hierarchy and
+ * an anchor Connector are given and the hierarchy already has a level
+ * with the number and refinement ratio being balanced, each box is
+ * therefore first moved to its home process: the process owning the
+ * most of the old level's cells under it, found through the old level's
+ * overlaps with the anchor.  Boxes over none of the old level stay with
+ * their owner, which is also their home process when there is no old
+ * level.  Diffusion then starts from where the level data is.
+ *
+ * Processes are connected in a static graph made of the chain of
+ * consecutive ranks in the RankGroup and, if an anchor Connector is
+ * given, the owners of adjacent boxes.  In each iteration, every
+ * process exchanges its load with its graph neighbors and sends
+ * \f$ \alpha (L_i - L_j) \f$ to each lighter neighbor j, where
+ * \f$ \alpha = 1/(1+\max(d_i,d_j)) \f$ and d is the graph degree.
+ * The work is sent as whole boxes, choosing those closest to the
+ * workload centroid of the receiver.  Iterations stop when the
+ * maximum load is within the tolerance of the average, when no box
+ * can be moved, or after max_iterations.
+ *
+ * Boxes heavier than max_box_fraction of the average load are chopped
+ * on overloaded processes so the flow can be matched.  An overloaded
+ * process that has lighter neighbors but cannot send anything halves
+ * this threshold and chops again, down to min_size.  Boxes that are
+ * neither chopped nor moved keep their BoxId.
+ *
+ * The migration caused by the last call to loadBalanceBoxLevel() (work
+ * and cells that ended up on a process other than their home process)
+ * is available from getMigratedWorkload() and getMigratedCells().
+ *
+ * If setWorkloadPatchDataIndex() has been called, box workloads are
+ * computed from the given cell-centered workload data.  Otherwise,
+ * the workload is the number of cells.
+ *
+ * User inputs (default):
+ *
+ *   - \b tolerance
+ *   Fractional imbalance to stop at.  Iterations end when the maximum
+ *   load is at most (1 + tolerance) times the average load.
+ *
+ *   - \b max_iterations
+ *   Maximum number of diffusion iterations per call.
+ *
+ *   - \b max_box_fraction
+ *   Boxes on overloaded processes heavier than this fraction of the
+ *   average load are chopped before moving work.
+ *
+ *   - \b tile_size
+ *   Tile size when using tile mode.  Tile mode restricts box cuts
+ *   to tile boundaries.  Default is 1, which is equivalent to no restriction.
+ *
+ *   - \b DEV_report_load_balance
+ *   Whether to report the load balance statistics, number of
+ *   iterations and migration volume of the result.
+ *
+ * <b> Details: </b> <br>
+ * <table>
+ *   <tr>
+ *     <th>parameter</th>
+ *     <th>type</th>
+ *     <th>default</th>
+ *     <th>range</th>
+ *     <th>opt/req</th>
+ *     <th>behavior on restart</th>
+ *   </tr>
+ *   <tr>
+ *     <td>tolerance</td>
+ *     <td>double</td>
+ *     <td>0.05</td>
+ *     <td>>=0</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>max_iterations</td>
+ *     <td>int</td>
+ *     <td>50</td>
+ *     <td>>=0</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>max_box_fraction</td>
+ *     <td>double</td>
+ *     <td>0.25</td>
+ *     <td>>0</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>tile_size</td>
+ *     <td>IntVector</td>
+ *     <td>1</td>
+ *     <td>1-</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>DEV_report_load_balance</td>
+ *     <td>bool</td>
+ *     <td>FALSE</td>
+ *     <td>TRUE/FALSE</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ * </table>
+ *
+ * @see LoadBalanceStrategy
+ */
+
+class DiffusionLoadBalancer:
+   public LoadBalanceStrategy
+{
+public:
+   /*!
+    * @brief Initializing constructor sets object state to default or,
+    * if database provided, to parameters in database.
+    *
+    * @param[in] dim
+    *
+    * @param[in] name User-defined std::string identifier used for error
+    * reporting and timer names.
+    *
+    * @param[in] input_db (optional) database pointer providing
+    * parameters from input file.  This pointer may be null indicating
+    * no input is used.
+    *
+    * @pre !name.empty()
+    */
+   DiffusionLoadBalancer(
+      const tbox::Dimension& dim,
+      const std::string& name,
+      const std::shared_ptr<tbox::Database>& input_db =
+         std::shared_ptr<tbox::Database>());
+
+   /*!
+    * @brief Virtual destructor releases all internal storage.
+    */
+   virtual ~DiffusionLoadBalancer();
+
+   /*!
+    * @brief Configure the load balancer to use the data stored
+    * in the hierarchy at the specified descriptor index
+    * for estimating the workload on each cell.
+    *
+    * @param data_id
+    * Integer value of patch data identifier for workload
+    * estimate on each cell.  An invalid value (i.e., < 0)
+    * indicates that a spatially-uniform work estimate
+    * will be used.  The default value is -1 (undefined)
+    * implying the uniform work estimate.
+    *
+    * @param level_number
+    * Optional integer number for level on which data id
+    * is used.  If no value is given, the data will be
+    * used for all levels.
+    *
+    * @pre hier::VariableDatabase::getDatabase()->getPatchDescriptor()->getPatchDataFactory(data_id) is actually a  std::shared_ptr<pdat::CellDataFactory<double> >
+    */
+   void
+   setWorkloadPatchDataIndex(
+      int data_id,
+      int level_number = -1);
+
+   /*!
+    * @brief Return true if load balancing procedure for given level
+    * depends on patch data on mesh; otherwise return false.
+    *
+    * @param[in] level_number  Integer patch level number.
+    */
+   bool
+   getLoadBalanceDependsOnPatchData(
+      int level_number) const;
+
+   /*!
+    * @copydoc LoadBalanceStrategy::loadBalanceBoxLevel()
+    *
+    * @pre !balance_to_anchor || balance_to_anchor->hasTranspose()
+    * @pre !balance_to_anchor || balance_to_anchor->isTransposeOf(balance_to_anchor->getTranspose())
+    * @pre (d_dim == balance_box_level.getDim()) &&
+    *      (d_dim == min_size.getDim()) && (d_dim == max_size.getDim()) &&
+    *      (d_dim == domain_box_level.getDim()) &&
+    *      (d_dim == bad_interval.getDim()) && (d_dim == cut_factor.getDim())
+    * @pre !hierarchy || (d_dim == hierarchy->getDim())
+    */
+   void
+   loadBalanceBoxLevel(
+      hier::BoxLevel& balance_box_level,
+      hier::Connector* balance_to_anchor,
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      const int level_number,
+      const hier::IntVector& min_size,
+      const hier::IntVector& max_size,
+      const hier::BoxLevel& domain_box_level,
+      const hier::IntVector& bad_interval,
+      const hier::IntVector& cut_factor,
+      const tbox::RankGroup& rank_group = tbox::RankGroup()) const;
+
+   /*!
+    * @brief Return the workload moved off its home process by the last
+    * call to loadBalanceBoxLevel(), summed over all processes.
+    *
+    * The home process is the owner in the old level, when there is one,
+    * or else the owner in the BoxLevel given.
+    */
+   double
+   getMigratedWorkload() const
+   {
+      return d_migrated_workload;
+   }
+
+   /*!
+    * @brief Return the number of cells moved off their home process by
+    * the last call to loadBalanceBoxLevel(), summed over all processes.
+    *
+    * @see getMigratedWorkload()
+    */
+   double
+   getMigratedCells() const
+   {
+      return d_migrated_cells;
+   }
+
+   /*!
+    * @brief Return the number of diffusion iterations taken by the last
+    * call to loadBalanceBoxLevel().
+    */
+   int
+   getNumberOfIterations() const
+   {
+      return d_num_iterations;
+   }
+
+   /*!
+    * @brief Get the name of this object.
+    */
+   const std::string&
+   getObjectName() const
+   {
+      return d_object_name;
+   }
+
+private:
+   /*!
+    * @brief A piece of an original box, held by the process currently
+    * assigned to it.
+    *
+    * d_orig_box is the box the piece came from, with its BoxId and
+    * owner before balancing.  d_home_rank is the process holding the
+    * level data of the piece, to which it is preferably returned.
+    */
+   struct Piece {
+      Piece(
+         const hier::Box& box,
+         const hier::Box& orig_box,
+         double weight,
+         int home_rank):
+         d_box(box),
+         d_orig_box(orig_box),
+         d_weight(weight),
+         d_home_rank(home_rank)
+      {
+      }
+
+      hier::Box d_box;
+      hier::Box d_orig_box;
+      double d_weight;
+      int d_home_rank;
+   };
+
+   static const int DiffusionLoadBalancer_EXCHANGETAG0 = 21;
+   static const int DiffusionLoadBalancer_EXCHANGETAG1 = 22;
+   static const int DiffusionLoadBalancer_MAPTAG = 23;
+   static const int DiffusionLoadBalancer_SEEDTAG = 24;
+   static const int DiffusionLoadBalancer_NBRTAG = 25;
+
+   /*!
+    * @brief Move each piece to the process owning most of the cells
+    * under it in the hierarchy's level level_number, and make that
+    * process its home.
+    *
+    * @param[in,out] pieces  Local pieces, each a whole box of
+    * balance_box_level.
+    *
+    * @pre hierarchy.levelExists(level_number)
+    */
+   void
+   seedOwners(
+      std::vector<Piece>& pieces,
+      const hier::BoxLevel& balance_box_level,
+      const hier::Connector& balance_to_anchor,
+      const hier::PatchHierarchy& hierarchy,
+      int level_number,
+      const tbox::RankGroup& rank_group) const;
+
+   /*!
+    * @brief Find the processes this process diffuses work with.
+    *
+    * The graph is symmetric: if j is a neighbor of i, i is a neighbor
+    * of j.
+    *
+    * @param[out] neighbors  Ranks of the neighbors, in increasing order.
+    */
+   void
+   findNeighborRanks(
+      std::vector<int>& neighbors,
+      const hier::BoxLevel& balance_box_level,
+      const hier::Connector* balance_to_anchor,
+      const tbox::RankGroup& rank_group) const;
+
+   /*!
+    * @brief Chop pieces heavier than max_weight.
+    *
+    * @return Number of pieces added.
+    */
+   int
+   chopHeavyPieces(
+      std::vector<Piece>& pieces,
+      double max_weight,
+      int my_rank,
+      const PartitioningParams& pparams) const;
+
+   /*!
+    * @brief Choose the pieces to send to each neighbor, given the
+    * loads and centroids of the neighbors.
+    *
+    * Pieces whose home is a neighbor go back to it first, then pieces
+    * that have already left their home, so that diffusion moves as few
+    * cells as it can.  No more is sent once the local load is down to
+    * max_load.
+    *
+    * @param[out] outgoing  Indices into pieces, for each neighbor.
+    */
+   void
+   choosePiecesToSend(
+      std::vector<std::vector<size_t> >& outgoing,
+      const std::vector<Piece>& pieces,
+      double local_load,
+      double max_load,
+      int degree,
+      int my_rank,
+      const std::vector<int>& neighbors,
+      const std::vector<double>& nbr_loads,
+      const std::vector<int>& nbr_degrees,
+      const std::vector<std::vector<double> >& nbr_centroids) const;
+
+   /*!
+    * @brief Send a message to, and receive a message from, each
+    * neighbor.
+    *
+    * @param[out] recv_data  Data received from each neighbor.
+    */
+   void
+   exchangeWithNeighbors(
+      std::vector<std::vector<char> >& recv_data,
+      const std::vector<std::shared_ptr<tbox::MessageStream> >& send_streams,
+      tbox::AsyncCommPeer<char>* send_comms,
+      tbox::AsyncCommPeer<char>* recv_comms,
+      tbox::AsyncCommStage& send_stage,
+      tbox::AsyncCommStage& recv_stage) const;
+
+   /*!
+    * @brief Compute the workload-weighted centroid of the pieces.
+    */
+   void
+   computeCentroid(
+      std::vector<double>& centroid,
+      const std::vector<Piece>& pieces) const;
+
+   /*!
+    * @brief Return the workload in a box on the process owning it before
+    * balancing.
+    */
+   double
+   computeBoxWeight(
+      const hier::Box& box,
+      const hier::BoxId& orig_box_id) const;
+
+   /*!
+    * @brief Return the workload data id for the given level.
+    */
+   int
+   getWorkloadDataId(
+      int level_number) const
+   {
+      TBOX_ASSERT(level_number >= 0);
+      return level_number < static_cast<int>(d_workload_data_id.size()) ?
+             d_workload_data_id[level_number] : d_master_workload_data_id;
+   }
+
+   /*
+    * Read parameters from input database.
+    */
+   void
+   getFromInput(
+      const std::shared_ptr<tbox::Database>& input_db);
+
+   /*
+    * Set up timers.
+    */
+   void
+   setTimers();
+
+   const tbox::Dimension d_dim;
+
+   std::string d_object_name;
+
+   /*!
+    * @brief Workload data id for each level.
+    */
+   std::vector<int> d_workload_data_id;
+
+   /*!
+    * @brief Workload data id for levels not in d_workload_data_id.
+    */
+   int d_master_workload_data_id;
+
+   //! @brief See input parameter tolerance.
+   double d_tolerance;
+
+   //! @brief See input parameter max_iterations.
+   int d_max_iterations;
+
+   //! @brief See input parameter max_box_fraction.
+   double d_max_box_fraction;
+
+   /*!
+    * @brief Tile size, when restricting cuts to tile boundaries,
+    * Set to 1 when not restricting.
+    */
+   hier::IntVector d_tile_size;
+
+   //! @brief See input parameter DEV_report_load_balance.
+   bool d_report_load_balance;
+
+   /*!
+    * @brief Level holding workload data, valid only during
+    * loadBalanceBoxLevel.
+    */
+   mutable std::shared_ptr<hier::PatchLevel> d_workload_level;
+
+   //! @brief Workload data id used for the current balance.
+   mutable int d_current_workload_data_id;
+
+   //! @brief Migrated workload of the last balance.
+   mutable double d_migrated_workload;
+
+   //! @brief Migrated cells of the last balance.
+   mutable double d_migrated_cells;
+
+   //! @brief Number of iterations of the last balance.
+   mutable int d_num_iterations;
+
+   /*
+    * Performance timers.
+    */
+   std::shared_ptr<tbox::Timer> t_load_balance_box_level;
+   std::shared_ptr<tbox::Timer> t_seed_owners;
+   std::shared_ptr<tbox::Timer> t_find_neighbors;
+   std::shared_ptr<tbox::Timer> t_diffuse;
+   std::shared_ptr<tbox::Timer> t_move_boxes;
+   std::shared_ptr<tbox::Timer> t_use_map;
+
+};
+
+}
+}
+
+#endif
@@ -1156,7 +1156,8 @@ private:
       const tbox::SAMRAI_MPI& mpi) const;
 
    /*
-    * @brief Record statistics on how many patches and cells were generated.
+    * @brief Record statistics on how many patches and cells were generated
+    * and how many bytes of patch metadata they use.
     */
    void
    recordStatistics(
@@ -1423,11 +1424,13 @@ private:
 
 #ifdef GA_RECORD_STATS
    /*
-    * Statistics on number of cells and patches generated.
+    * Statistics on number of cells and patches generated, and on the
+    * patch metadata bytes held for them.
     */
    std::vector<std::shared_ptr<tbox::Statistic> > d_boxes_stat;
    std::vector<std::shared_ptr<tbox::Statistic> > d_cells_stat;
    std::vector<std::shared_ptr<tbox::Statistic> > d_timestamp_stat;
+   std::vector<std::shared_ptr<tbox::Statistic> > d_metadata_stat;
 #endif
 
    // The following are not yet implemented:
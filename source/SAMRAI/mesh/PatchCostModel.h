@@ -0,0 +1,441 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2018 Lawrence Livermore National Security, LLC
+ * Description:   Workload model fitted to measured patch compute times.
+ *
+ ************************************************************************/
+
+#ifndef included_mesh_PatchCostModel
+#define included_mesh_PatchCostModel
+
+#include "SAMRAI/SAMRAI_config.h"
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/BoxId.h"
+#include "SAMRAI/hier/Patch.h"
+#include "SAMRAI/hier/PatchLevel.h"
+#include "SAMRAI/pdat/CellVariable.h"
+#include "SAMRAI/tbox/Database.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+#include "SAMRAI/tbox/Timer.h"
+
+#include <deque>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace SAMRAI {
+namespace mesh {
+
+/*!
+ * @brief Workload model fitted to the measured compute time of patches,
+ * which fills a workload PatchData for the load balancers.
+ *
+ * The workload data ids accepted by the load balancers (see, for
+ * example, CascadePartitioner::setWorkloadPatchDataIndex()) are
+ * usually filled by the application, often with a constant.  This
+ * class closes the loop between measured cost and partitioning:
+ *
+ * -# An integrator brackets the numerical kernels on each patch with
+ *    startPatch() and stopPatch(), which accumulate the wall-clock time
+ *    of the patch.  The application may also accumulate its own
+ *    per-patch counters (e.g., iterations of a local solver) with
+ *    addToUserCounter().
+ * -# After each advance of a level, updateWorkload() turns the
+ *    measurements of the level into samples, refits the model and
+ *    fills the workload data on the level.
+ * -# The load balancer is given getWorkloadDataId(), so the next
+ *    loadBalanceBoxLevel() call uses the modeled cost.
+ *
+ * The cost of a patch is modeled as
+ * \f[
+ *   c_0 + c_1 n + c_2 g + c_3 l n + \sum_k u_k m_k
+ * \f]
+ * where n is the number of cells, g the number of ghost cells (for the
+ * maximum ghost width of the patch descriptor), l the level number and
+ * m_k the user counters.  The coefficients are fitted by least squares
+ * over the most recent samples of all processes.  Until the first fit,
+ * and where the model predicts a nonpositive cost, the cost is the
+ * number of cells times the mean measured cost per cell.
+ *
+ * The workload data holds the patch cost divided evenly among the
+ * patch cells.  fillWorkload() fills it on levels without measurements
+ * (e.g., new levels), using mean counter densities for the user
+ * counters.  HyperbolicLevelIntegrator and MethodOfLinesIntegrator
+ * drive the measurements and updates when given a model with their
+ * setPatchCostModel() methods.
+ *
+ * With track_memory, the model also fills a memory PatchData with the
+ * bytes per cell of the data allocated on each patch (see
+ * BalanceUtilities::fillMemoryLoad()), for
+ * CascadePartitioner::setMemoryPatchDataIndex().
+ *
+ * User inputs (default):
+ *
+ *   - \b number_of_user_counters
+ *   Number of user counters included in the model.
+ *
+ *   - \b max_samples
+ *   Maximum number of samples kept on each process.  Older samples
+ *   are discarded first, so the model follows changes in the cost.
+ *
+ *   - \b fit_interval
+ *   Number of updateWorkload() calls between fits.
+ *
+ *   - \b track_memory
+ *   Whether to fill memory data along with the workload data.
+ *
+ *   - \b DEV_report_fit
+ *   Whether to log the coefficients after each fit.
+ *
+ * <b> Details: </b> <br>
+ * <table>
+ *   <tr>
+ *     <th>parameter</th>
+ *     <th>type</th>
+ *     <th>default</th>
+ *     <th>range</th>
+ *     <th>opt/req</th>
+ *     <th>behavior on restart</th>
+ *   </tr>
+ *   <tr>
+ *     <td>number_of_user_counters</td>
+ *     <td>int</td>
+ *     <td>0</td>
+ *     <td>>=0</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>max_samples</td>
+ *     <td>int</td>
+ *     <td>1000</td>
+ *     <td>>=1</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>fit_interval</td>
+ *     <td>int</td>
+ *     <td>1</td>
+ *     <td>>=1</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>track_memory</td>
+ *     <td>bool</td>
+ *     <td>FALSE</td>
+ *     <td>TRUE/FALSE</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>DEV_report_fit</td>
+ *     <td>bool</td>
+ *     <td>FALSE</td>
+ *     <td>TRUE/FALSE</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ * </table>
+ *
+ * @see LoadBalanceStrategy
+ */
+
+class PatchCostModel
+{
+public:
+   /*!
+    * @brief Constructor registers the workload variable and reads
+    * parameters from the input database.
+    *
+    * @param[in] dim
+    *
+    * @param[in] name User-defined std::string identifier used for error
+    * reporting, timer names and the workload variable name.
+    *
+    * @param[in] input_db (optional) database pointer providing
+    * parameters from input file.  This pointer may be null indicating
+    * no input is used.
+    *
+    * @pre !name.empty()
+    */
+   PatchCostModel(
+      const tbox::Dimension& dim,
+      const std::string& name,
+      const std::shared_ptr<tbox::Database>& input_db =
+         std::shared_ptr<tbox::Database>());
+
+   /*!
+    * @brief Destructor.
+    */
+   ~PatchCostModel();
+
+   /*!
+    * @brief Return the patch data id of the workload data, for
+    * setWorkloadPatchDataIndex() of a load balancer.
+    */
+   int
+   getWorkloadDataId() const
+   {
+      return d_workload_data_id;
+   }
+
+   /*!
+    * @brief Return the patch data id of the memory data, or -1 if
+    * track_memory is off.
+    */
+   int
+   getMemoryDataId() const
+   {
+      return d_memory_data_id;
+   }
+
+   /*!
+    * @brief Start timing work on a patch.
+    *
+    * @pre no other patch is being timed
+    */
+   void
+   startPatch(
+      const hier::Patch& patch);
+
+   /*!
+    * @brief Stop timing work on a patch and add the elapsed time to the
+    * patch's measurement.
+    *
+    * @pre startPatch() was called for this patch
+    */
+   void
+   stopPatch(
+      const hier::Patch& patch);
+
+   /*!
+    * @brief Add an amount to a user counter of a patch.
+    *
+    * @pre (counter >= 0) && (counter < getNumberOfUserCounters())
+    */
+   void
+   addToUserCounter(
+      const hier::Patch& patch,
+      int counter,
+      double amount);
+
+   /*!
+    * @brief Turn the measurements on a level into samples, refit the
+    * model every fit_interval calls, and fill the workload data on the
+    * level.
+    *
+    * This is collective over the MPI of the level.
+    *
+    * @pre level
+    */
+   void
+   updateWorkload(
+      const std::shared_ptr<hier::PatchLevel>& level);
+
+   /*!
+    * @brief Fill the workload data (and memory data, if tracked) on a
+    * level from the current model, allocating it if needed.
+    *
+    * Measurements of the level are not used.  This is local.
+    *
+    * @pre level
+    */
+   void
+   fillWorkload(
+      const std::shared_ptr<hier::PatchLevel>& level) const;
+
+   /*!
+    * @brief Fit the model to the samples of all processes.
+    *
+    * This is collective over mpi.
+    */
+   void
+   fitModel(
+      const tbox::SAMRAI_MPI& mpi);
+
+   /*!
+    * @brief Return the modeled cost of a box.
+    *
+    * @param[in] box
+    * @param[in] level_number
+    * @param[in] user_counts  Values of the user counters.  If null, the
+    * counters are estimated from their mean densities in the samples.
+    */
+   double
+   estimateCost(
+      const hier::Box& box,
+      int level_number,
+      const double* user_counts = 0) const;
+
+   /*!
+    * @brief Return the fitted coefficients, in the order of the terms
+    * in the class description.  Empty before the first fit.
+    */
+   const std::vector<double>&
+   getCoefficients() const
+   {
+      return d_coefficients;
+   }
+
+   /*!
+    * @brief Return the number of user counters.
+    */
+   int
+   getNumberOfUserCounters() const
+   {
+      return d_num_user_counters;
+   }
+
+   /*!
+    * @brief Return the number of samples on this process.
+    */
+   int
+   getNumberOfSamples() const
+   {
+      return static_cast<int>(d_samples.size());
+   }
+
+   /*!
+    * @brief Print the model parameters and coefficients.
+    */
+   void
+   printClassData(
+      std::ostream& os) const;
+
+   /*!
+    * @brief Get the name of this object.
+    */
+   const std::string&
+   getObjectName() const
+   {
+      return d_object_name;
+   }
+
+private:
+   // The following are not implemented:
+   PatchCostModel(
+      const PatchCostModel&);
+
+   PatchCostModel&
+   operator = (
+      const PatchCostModel&);
+
+   /*!
+    * @brief Time and user counters accumulated on a patch since the
+    * last update of its level.
+    */
+   struct Measurement {
+      double d_time;
+      std::vector<double> d_user_counts;
+   };
+
+   /*!
+    * @brief A measured patch: its model terms and time.
+    */
+   struct Sample {
+      std::vector<double> d_terms;
+      double d_time;
+   };
+
+   /*!
+    * @brief Number of model terms other than the user counters.
+    */
+   static const int NUM_GEOMETRIC_TERMS = 4;
+
+   /*!
+    * @brief Compute the model terms of a box.
+    */
+   void
+   computeTerms(
+      std::vector<double>& terms,
+      const hier::Box& box,
+      int level_number,
+      const double* user_counts) const;
+
+   /*!
+    * @brief Find the Measurement of a patch, creating it if needed.
+    */
+   Measurement&
+   getMeasurement(
+      const hier::Patch& patch);
+
+   /*
+    * Read parameters from input database.
+    */
+   void
+   getFromInput(
+      const std::shared_ptr<tbox::Database>& input_db);
+
+   const tbox::Dimension d_dim;
+
+   std::string d_object_name;
+
+   std::shared_ptr<pdat::CellVariable<double> > d_workload_variable;
+
+   int d_workload_data_id;
+
+   std::shared_ptr<pdat::CellVariable<double> > d_memory_variable;
+
+   //! @brief Memory data id, -1 unless track_memory is on.
+   int d_memory_data_id;
+
+   //! @brief See input parameter number_of_user_counters.
+   int d_num_user_counters;
+
+   //! @brief See input parameter max_samples.
+   int d_max_samples;
+
+   //! @brief See input parameter fit_interval.
+   int d_fit_interval;
+
+   //! @brief See input parameter track_memory.
+   bool d_track_memory;
+
+   //! @brief See input parameter DEV_report_fit.
+   bool d_report_fit;
+
+   /*!
+    * @brief Measurements since the last update, for each level.
+    */
+   std::vector<std::map<hier::BoxId, Measurement> > d_measurements;
+
+   /*!
+    * @brief Most recent samples, oldest first.
+    */
+   std::deque<Sample> d_samples;
+
+   /*!
+    * @brief Fitted coefficients, empty before the first fit.
+    */
+   std::vector<double> d_coefficients;
+
+   //! @brief Mean measured cost per cell, from the last fit.
+   double d_cost_per_cell;
+
+   //! @brief Mean user counter per cell, from the last fit.
+   std::vector<double> d_user_counts_per_cell;
+
+   //! @brief Number of calls to updateWorkload().
+   int d_num_updates;
+
+   //! @brief Patch being timed, and when its timing started.
+   hier::BoxId d_timed_patch;
+   int d_timed_level;
+   double d_start_time;
+
+   std::shared_ptr<tbox::Timer> t_update_workload;
+   std::shared_ptr<tbox::Timer> t_fit_model;
+
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,484 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2018 Lawrence Livermore National Security, LLC
+ * Description:   Load balancer using a Hilbert space-filling curve.
+ *
+ ************************************************************************/
+
+#ifndef included_mesh_SFCLoadBalancer
+#define included_mesh_SFCLoadBalancer
+
+#include "SAMRAI/SAMRAI_config.h"
+#include "SAMRAI/mesh/LoadBalanceStrategy.h"
+#include "SAMRAI/mesh/PartitioningParams.h"
+#include "SAMRAI/hier/MappingConnector.h"
+#include "SAMRAI/hier/PatchLevel.h"
+#include "SAMRAI/tbox/Database.h"
+#include "SAMRAI/tbox/MessageStream.h"
+#include "SAMRAI/tbox/RankGroup.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+#include "SAMRAI/tbox/Timer.h"
+#include "SAMRAI/tbox/Utilities.h"
+
+#include <iostream>
+#include <map>
+#include <vector>
+#include <memory>
+
+namespace SAMRAI {
+namespace mesh {
+
+/*!
+ * @brief Load balancer that orders boxes along a Hilbert space-filling
+ * curve and cuts the curve into pieces of equal workload.
+ *
+ * Each box is given a key from the Hilbert index of its centroid,
+ * computed in the index space of its block and normalized to the
+ * bounding box of that block's domain.  Keys of different blocks are
+ * offset by block number, so the curve visits the blocks in order.
+ *
+ * The ordering is computed in parallel by a weighted bucket sort.  The
+ * key range of each block is divided into histogram_bins bins, the
+ * workload of each bin is summed over all processes, and each bin is
+ * assigned to the process whose share of the total workload contains
+ * it.  Each process sends its boxes to the owners of their bins, where
+ * they are sorted.  The position of each box along the curve is then
+ * found with a single prefix sum (MPI_Scan) over the bucket workloads
+ * and returned to the owner.
+ *
+ * The collectives are reductions and scans of fixed size, so their cost
+ * grows as log P.  Boxes move with a sparse exchange (synchronous sends
+ * and a nonblocking barrier), so each process only communicates with
+ * the processes it actually exchanges boxes with.  No per-process
+ * arrays of size P are used, except for an Alltoall of message sizes
+ * when the MPI library predates MPI-3.  The bin resolution limits only
+ * how evenly the sorting work is spread, not the resulting partition.
+ *
+ * The curve is cut at multiples of W/P, where W is the total workload
+ * and P is the size of the RankGroup.  Boxes lying between two cuts go
+ * to the corresponding process.  Boxes straddling a cut are chopped
+ * across their longest direction at the plane whose workload best
+ * matches the cut, subject to min_size, cut_factor and bad_interval;
+ * the pieces go to the processes containing their workload midpoints.
+ *
+ * If setWorkloadPatchDataIndex() has been called, box workloads (and
+ * the positions of cuts within boxes) are computed from the given
+ * cell-centered workload data.  Otherwise, the workload is the number
+ * of cells.
+ *
+ * User inputs (default):
+ *
+ *   - \b histogram_bins
+ *   Number of histogram bins per block for distributing the parallel
+ *   sort.  More bins give more evenly sized sort buckets at the cost of
+ *   a larger Allreduce.  The cost does not depend on the number of
+ *   processes.
+ *
+ *   - \b chop_at_cuts
+ *   Whether to chop boxes that straddle a cut in the curve.  If false,
+ *   each box goes whole to the process containing its workload
+ *   midpoint, which can give poor balance when boxes are large.
+ *
+ *   - \b tile_size
+ *   Tile size when using tile mode.  Tile mode restricts box cuts
+ *   to tile boundaries.  Default is 1, which is equivalent to no restriction.
+ *
+ *   - \b DEV_report_load_balance
+ *   Whether to report the load balance statistics of the result.
+ *
+ * <b> Details: </b> <br>
+ * <table>
+ *   <tr>
+ *     <th>parameter</th>
+ *     <th>type</th>
+ *     <th>default</th>
+ *     <th>range</th>
+ *     <th>opt/req</th>
+ *     <th>behavior on restart</th>
+ *   </tr>
+ *   <tr>
+ *     <td>histogram_bins</td>
+ *     <td>int</td>
+ *     <td>1024</td>
+ *     <td>>=1</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>chop_at_cuts</td>
+ *     <td>bool</td>
+ *     <td>TRUE</td>
+ *     <td>TRUE/FALSE</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>tile_size</td>
+ *     <td>IntVector</td>
+ *     <td>1</td>
+ *     <td>1-</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>DEV_report_load_balance</td>
+ *     <td>bool</td>
+ *     <td>FALSE</td>
+ *     <td>TRUE/FALSE</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ * </table>
+ *
+ * @see LoadBalanceStrategy
+ */
+
+class SFCLoadBalancer:
+   public LoadBalanceStrategy
+{
+public:
+   /*!
+    * @brief Initializing constructor sets object state to default or,
+    * if database provided, to parameters in database.
+    *
+    * @param[in] dim
+    *
+    * @param[in] name User-defined std::string identifier used for error
+    * reporting and timer names.
+    *
+    * @param[in] input_db (optional) database pointer providing
+    * parameters from input file.  This pointer may be null indicating
+    * no input is used.
+    *
+    * @pre !name.empty()
+    */
+   SFCLoadBalancer(
+      const tbox::Dimension& dim,
+      const std::string& name,
+      const std::shared_ptr<tbox::Database>& input_db =
+         std::shared_ptr<tbox::Database>());
+
+   /*!
+    * @brief Virtual destructor releases all internal storage.
+    */
+   virtual ~SFCLoadBalancer();
+
+   /*!
+    * @brief Configure the load balancer to use the data stored
+    * in the hierarchy at the specified descriptor index
+    * for estimating the workload on each cell.
+    *
+    * @param data_id
+    * Integer value of patch data identifier for workload
+    * estimate on each cell.  An invalid value (i.e., < 0)
+    * indicates that a spatially-uniform work estimate
+    * will be used.  The default value is -1 (undefined)
+    * implying the uniform work estimate.
+    *
+    * @param level_number
+    * Optional integer number for level on which data id
+    * is used.  If no value is given, the data will be
+    * used for all levels.
+    *
+    * @pre hier::VariableDatabase::getDatabase()->getPatchDescriptor()->getPatchDataFactory(data_id) is actually a  std::shared_ptr<pdat::CellDataFactory<double> >
+    */
+   void
+   setWorkloadPatchDataIndex(
+      int data_id,
+      int level_number = -1);
+
+   /*!
+    * @brief Return true if load balancing procedure for given level
+    * depends on patch data on mesh; otherwise return false.
+    *
+    * @param[in] level_number  Integer patch level number.
+    */
+   bool
+   getLoadBalanceDependsOnPatchData(
+      int level_number) const;
+
+   /*!
+    * @copydoc LoadBalanceStrategy::loadBalanceBoxLevel()
+    *
+    * @pre !balance_to_anchor || balance_to_anchor->hasTranspose()
+    * @pre !balance_to_anchor || balance_to_anchor->isTransposeOf(balance_to_anchor->getTranspose())
+    * @pre (d_dim == balance_box_level.getDim()) &&
+    *      (d_dim == min_size.getDim()) && (d_dim == max_size.getDim()) &&
+    *      (d_dim == domain_box_level.getDim()) &&
+    *      (d_dim == bad_interval.getDim()) && (d_dim == cut_factor.getDim())
+    * @pre !hierarchy || (d_dim == hierarchy->getDim())
+    */
+   void
+   loadBalanceBoxLevel(
+      hier::BoxLevel& balance_box_level,
+      hier::Connector* balance_to_anchor,
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      const int level_number,
+      const hier::IntVector& min_size,
+      const hier::IntVector& max_size,
+      const hier::BoxLevel& domain_box_level,
+      const hier::IntVector& bad_interval,
+      const hier::IntVector& cut_factor,
+      const tbox::RankGroup& rank_group = tbox::RankGroup()) const;
+
+   /*!
+    * @brief Compute the Hilbert index of a point.
+    *
+    * The index orders the points of a 2^num_bits sided grid along a
+    * Hilbert curve.  Coordinates must lie in [0, 2^num_bits).
+    *
+    * @param[in] coords  Integer coordinates, one per dimension.
+    *
+    * @param[in] num_bits  Number of bits per coordinate.
+    *
+    * @pre coords.size() * num_bits <= 64
+    */
+   static unsigned long long
+   computeHilbertIndex(
+      const std::vector<unsigned int>& coords,
+      int num_bits);
+
+   /*!
+    * @brief Get the name of this object.
+    */
+   const std::string&
+   getObjectName() const
+   {
+      return d_object_name;
+   }
+
+private:
+   /*!
+    * @brief A box's position in the curve ordering, with the data needed
+    * to ship it through the parallel sort.
+    *
+    * Boxes are ordered by block, then Hilbert index, then owner and
+    * LocalId, so the order is total and independent of the process
+    * count.
+    */
+   struct CurveItem {
+      int d_block;
+      unsigned long long d_key;
+      int d_owner;
+      int d_local_id;
+      double d_weight;
+
+      bool
+      operator < (
+         const CurveItem& other) const
+      {
+         if (d_block != other.d_block) {
+            return d_block < other.d_block;
+         }
+         if (d_key != other.d_key) {
+            return d_key < other.d_key;
+         }
+         if (d_owner != other.d_owner) {
+            return d_owner < other.d_owner;
+         }
+         return d_local_id < other.d_local_id;
+      }
+
+      //! @brief Write to a buffer of CURVE_ITEM_SIZE doubles.
+      void
+      pack(
+         double* buffer) const;
+
+      //! @brief Read from a buffer of CURVE_ITEM_SIZE doubles.
+      void
+      unpack(
+         const double* buffer);
+   };
+
+   /*!
+    * @brief A piece of an original box, with its place on the curve and
+    * its destination.
+    */
+   struct CurvePiece {
+      CurvePiece(
+         const hier::Box& box,
+         double start,
+         double weight):
+         d_box(box),
+         d_start(start),
+         d_weight(weight),
+         d_dest(-1)
+      {
+      }
+
+      hier::Box d_box;
+      double d_start;
+      double d_weight;
+      int d_dest;
+   };
+
+   //! @brief Number of doubles in a packed CurveItem.
+   static const int CURVE_ITEM_SIZE = 6;
+
+   static const int SFCLoadBalancer_SORTTAG = 11;
+   static const int SFCLoadBalancer_PREFIXTAG = 12;
+   static const int SFCLoadBalancer_BOXTAG = 13;
+
+   /*!
+    * @brief Set up the curve items for the local boxes.
+    *
+    * @param[out] items  Items in the same order as the boxes of
+    * balance_box_level.
+    */
+   void
+   computeCurveItems(
+      std::vector<CurveItem>& items,
+      const hier::BoxLevel& balance_box_level,
+      const PartitioningParams& pparams) const;
+
+   /*!
+    * @brief Find the workload preceding each local box on the curve.
+    *
+    * @param[out] prefix  Workload of all boxes before each item, in the
+    * order of items.
+    *
+    * @param[in] items  Local curve items.
+    *
+    * @param[in] global_weight  Total workload on the level.
+    *
+    * @param[in] mpi
+    */
+   void
+   computeCurvePrefix(
+      std::vector<double>& prefix,
+      const std::vector<CurveItem>& items,
+      int num_blocks,
+      double global_weight,
+      const tbox::SAMRAI_MPI& mpi) const;
+
+   /*!
+    * @brief Choose the bucket (sorting process) of each sorted local
+    * item from a global workload histogram of the curve keys.
+    *
+    * @param[out] buckets  Bucket of each item, nondecreasing.
+    */
+   void
+   computeBuckets(
+      std::vector<int>& buckets,
+      const std::vector<CurveItem>& sorted_items,
+      int num_blocks,
+      double global_weight,
+      const tbox::SAMRAI_MPI& mpi) const;
+
+   /*!
+    * @brief Cut a box at the curve cut points it straddles.
+    *
+    * @param[out] pieces  Pieces of the box, in curve order.
+    */
+   void
+   cutBoxAtCurveCuts(
+      std::vector<CurvePiece>& pieces,
+      const hier::Box& box,
+      double start,
+      double weight,
+      double global_weight,
+      int num_parts,
+      const std::shared_ptr<hier::Patch>& work_patch,
+      const PartitioningParams& pparams) const;
+
+   /*!
+    * @brief Workload of each plane of cells of a box normal to a given
+    * direction.
+    */
+   void
+   computePlaneWeights(
+      std::vector<double>& plane_weights,
+      const hier::Box& box,
+      tbox::Dimension::dir_t dir,
+      const std::shared_ptr<hier::Patch>& work_patch) const;
+
+   /*!
+    * @brief Return the workload in a box.
+    */
+   double
+   computeBoxWeight(
+      const hier::Box& box,
+      const std::shared_ptr<hier::Patch>& work_patch) const;
+
+   /*!
+    * @brief Return the workload data id for the given level.
+    */
+   int
+   getWorkloadDataId(
+      int level_number) const
+   {
+      TBOX_ASSERT(level_number >= 0);
+      return level_number < static_cast<int>(d_workload_data_id.size()) ?
+             d_workload_data_id[level_number] : d_master_workload_data_id;
+   }
+
+   /*
+    * Read parameters from input database.
+    */
+   void
+   getFromInput(
+      const std::shared_ptr<tbox::Database>& input_db);
+
+   /*
+    * Set up timers.
+    */
+   void
+   setTimers();
+
+   const tbox::Dimension d_dim;
+
+   std::string d_object_name;
+
+   /*!
+    * @brief Workload data id for each level.
+    */
+   std::vector<int> d_workload_data_id;
+
+   /*!
+    * @brief Workload data id for levels not in d_workload_data_id.
+    */
+   int d_master_workload_data_id;
+
+   //! @brief See input parameter histogram_bins.
+   int d_histogram_bins;
+
+   //! @brief See input parameter chop_at_cuts.
+   bool d_chop_at_cuts;
+
+   /*!
+    * @brief Tile size, when restricting cuts to tile boundaries,
+    * Set to 1 when not restricting.
+    */
+   hier::IntVector d_tile_size;
+
+   //! @brief See input parameter DEV_report_load_balance.
+   bool d_report_load_balance;
+
+   /*!
+    * @brief Level holding workload data, valid only during
+    * loadBalanceBoxLevel.
+    */
+   mutable std::shared_ptr<hier::PatchLevel> d_workload_level;
+
+   //! @brief Workload data id used for the current balance.
+   mutable int d_current_workload_data_id;
+
+   /*
+    * Performance timers.
+    */
+   std::shared_ptr<tbox::Timer> t_load_balance_box_level;
+   std::shared_ptr<tbox::Timer> t_compute_keys;
+   std::shared_ptr<tbox::Timer> t_sort;
+   std::shared_ptr<tbox::Timer> t_cut_curve;
+   std::shared_ptr<tbox::Timer> t_move_boxes;
+   std::shared_ptr<tbox::Timer> t_use_map;
+
+};
+
+}
+}
+
+#endif
@@ -302,6 +302,35 @@ public:
       unsigned int src_depth,
       const hier::Box& box);
 
+   /*!
+    * Copy data from the source array data object into the given box of
+    * this array through a rotated index map, for the depths the two
+    * arrays have in common.
+    *
+    * Index box.lower() + x of this array is copied from index
+    * src_lower + sum_k x(k)*src_steps[k] of the source.  For transfers
+    * between multiblock blocks of different orientation, the steps are
+    * signed unit vectors given by the rotation.
+    *
+    * @param src       Const reference to source array data object.
+    * @param box       Box of this array to copy into.
+    * @param src_lower Source index copied to box.lower().
+    * @param src_steps Change in source index for a unit step along each
+    *                  axis of box.
+    *
+    * @pre (getDim() == src.getDim()) && (getDim() == box.getDim()) &&
+    *      (getDim() == src_lower.getDim())
+    * @pre src_steps.size() == getDim().getValue()
+    * @pre getBox().contains(box)
+    * @pre src.getBox() contains the source indices of box
+    */
+   void
+   copyWithRotation(
+      const ArrayData<TYPE>& src,
+      const hier::Box& box,
+      const hier::Index& src_lower,
+      const std::vector<hier::IntVector>& src_steps);
+
    /*!
     * Add data from the source array data object to this array data object
     * on the specified index space region.
@@ -451,6 +480,31 @@ public:
       const hier::BoxContainer& dest_boxes,
       const hier::Transformation& transformation) const;
 
+   /*!
+    * Pack data of this array into a buffer through a rotated index map.
+    *
+    * The buffer receives getDepth()*box.size() values, ordered by depth
+    * and then by the indices of box, with the first coordinate varying
+    * fastest.  The value for index box.lower() + x comes from index
+    * src_lower + sum_k x(k)*src_steps[k] of this array.
+    *
+    * @param buffer    Pointer to the first value to pack.
+    * @param box       Box in the destination index space.
+    * @param src_lower Index of this array packed for box.lower().
+    * @param src_steps Change in index of this array for a unit step along
+    *                  each axis of box.
+    *
+    * @pre (getDim() == box.getDim()) && (getDim() == src_lower.getDim())
+    * @pre src_steps.size() == getDim().getValue()
+    * @pre getBox() contains the source indices of box
+    */
+   void
+   packWithRotation(
+      TYPE* buffer,
+      const hier::Box& box,
+      const hier::Index& src_lower,
+      const std::vector<hier::IntVector>& src_steps) const;
+
    /*!
     * Unpack data from the stream into the index region specified.
     *
@@ -14,8 +14,11 @@
 #include "SAMRAI/SAMRAI_config.h"
 
 #include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/Index.h"
 #include "SAMRAI/hier/IntVector.h"
 
+#include <vector>
+
 namespace SAMRAI {
 namespace pdat {
 
@@ -104,6 +107,85 @@ public:
       const hier::Box& opbox,
       bool src_is_buffer,
       const OP& op);
+
+   /*!
+    * Perform operation on a subset of data components of source and
+    * destination array data objects, where the source indices are a
+    * rotated map of the destination indices, and put results in
+    * destination array data object.
+    *
+    * Destination index opbox.lower() + x is paired with source index
+    * src_lower + sum_k x(k)*src_steps[k].  For the rotations between
+    * multiblock blocks, the steps are signed unit vectors.  The map is
+    * reduced to a starting source offset and a signed source stride for
+    * each axis of opbox, so the elements are visited with strided loops
+    * rather than index arithmetic.
+    *
+    * @param dst    Reference to destination array data object.
+    * @param src    Const reference to source array data object.
+    * @param opbox  Const reference to Box indicating index space region of
+    *               operation in destination array.
+    * @param src_lower  Source index paired with opbox.lower().
+    * @param src_steps  Change in source index for a unit step along each
+    *                   axis of opbox.
+    * @param num_depth  Integer number of depth components, starting at 0,
+    *                   on which to perform operation.
+    * @param op  Const reference to object that performs operations on
+    *            individual data array elements.
+    *
+    * @pre (dst.getDim() == src.getDim()) &&
+    *      (dst.getDim() == opbox.getDim()) &&
+    *      (dst.getDim() == src_lower.getDim())
+    * @pre src_steps.size() == dst.getDim().getValue()
+    * @pre (num_depth <= dst.getDepth()) && (num_depth <= src.getDepth())
+    * @pre dst.getBox().contains(opbox)
+    * @pre src.getBox() contains the source indices of opbox
+    */
+   static void
+   doArrayDataRotatedOperationOnBox(
+      ArrayData<TYPE>& dst,
+      const ArrayData<TYPE>& src,
+      const hier::Box& opbox,
+      const hier::Index& src_lower,
+      const std::vector<hier::IntVector>& src_steps,
+      unsigned int num_depth,
+      const OP& op);
+
+   /*!
+    * Perform operation on all data components of array data object,
+    * visited through a rotated index map, putting results in buffer.
+    *
+    * The buffer is ordered by depth and then by the indices of opbox,
+    * with the first coordinate varying fastest.  Buffer entry for index
+    * opbox.lower() + x is paired with array index
+    * src_lower + sum_k x(k)*src_steps[k].
+    *
+    * @param arraydata   Const reference to array data object.
+    * @param buffer      Pointer to first element in buffer, which must hold
+    *                    arraydata.getDepth()*opbox.size() elements.
+    * @param opbox       Const reference to Box indicating operation region
+    *                    in the index space of the buffer.
+    * @param src_lower   Array index paired with opbox.lower().
+    * @param src_steps   Change in array index for a unit step along each
+    *                    axis of opbox.
+    * @param op  Const reference to object that performs operations on
+    *            individual data array elements.
+    *
+    * @pre (arraydata.getDim() == opbox.getDim()) &&
+    *      (arraydata.getDim() == src_lower.getDim())
+    * @pre src_steps.size() == arraydata.getDim().getValue()
+    * @pre buffer != 0
+    * @pre arraydata.getBox() contains the array indices of opbox
+    */
+   static void
+   doArrayDataRotatedBufferOperationOnBox(
+      const ArrayData<TYPE>& arraydata,
+      TYPE* buffer,
+      const hier::Box& opbox,
+      const hier::Index& src_lower,
+      const std::vector<hier::IntVector>& src_steps,
+      const OP& op);
+
 private:
    // the following are not implemented:
    ArrayDataOperationUtilities();
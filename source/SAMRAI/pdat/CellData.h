@@ -23,6 +23,7 @@
 
 #include <iostream>
 #include <memory>
+#include <vector>
 
 namespace SAMRAI {
 namespace pdat {
@@ -281,6 +282,15 @@ public:
    virtual bool
    canEstimateStreamSizeFromBox() const;
 
+   /*!
+    * @brief Return true if TYPE is double, so the data can be
+    * communicated with reduced precision.
+    *
+    * @see hier::PatchData::packStreamWithPrecision()
+    */
+   virtual bool
+   canPackWithReducedPrecision() const;
+
    /*!
     * @brief Return the number of bytes needed to stream the data
     * in this patch data object lying in the specified box overlap
@@ -480,6 +490,18 @@ private:
       tbox::MessageStream& stream,
       const CellOverlap& overlap) const;
 
+   /*
+    * Compute the source index of box.lower() and the change in source
+    * index along each axis of box, for the rotated copies.
+    */
+   static void
+   getRotatedIndexMap(
+      hier::Index& src_lower,
+      std::vector<hier::IntVector>& src_steps,
+      const hier::Box& box,
+      const hier::Transformation::RotationIdentifier back_rotate,
+      const hier::IntVector& back_shift);
+
    int d_depth;
 
    std::shared_ptr<ArrayData<TYPE> > d_data;
@@ -0,0 +1,192 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2018 Lawrence Livermore National Security, LLC
+ * Description:   Templated cell centered patch data holding several
+ *                components in one allocation
+ *
+ ************************************************************************/
+
+#ifndef included_pdat_CellDataGroup
+#define included_pdat_CellDataGroup
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/pdat/CellData.h"
+
+#include <vector>
+
+namespace SAMRAI {
+namespace pdat {
+
+/*!
+ * @brief Class CellDataGroup<TYPE> holds several cell-centered components,
+ * each with its own depth, in a single CellData<TYPE> allocation.
+ *
+ * The components are stored one after another along the depth of the
+ * underlying array: component c occupies depths getStartDepth(c) through
+ * getStartDepth(c) + getComponentDepth(c) - 1.  To the rest of SAMRAI the
+ * group is a CellData<TYPE> of depth equal to the sum of the component
+ * depths.  A communication schedule therefore creates one transaction,
+ * with one copy or one message section, per overlap for the whole group
+ * rather than one per component, and the cell-centered transfer operators
+ * apply to all components at once.
+ *
+ * Groups are created by CellDataGroupFactory, which is installed by the
+ * component constructor of CellVariable<TYPE>.
+ *
+ * @see CellData
+ * @see CellDataGroupFactory
+ * @see CellVariable
+ */
+
+template<class TYPE>
+class CellDataGroup:public CellData<TYPE>
+{
+public:
+   /*!
+    * @brief The constructor for a cell data group.
+    *
+    * @param box const Box reference describing the interior of the
+    *            standard CELL-centered index box over which the
+    *            data will be created.
+    * @param component_depths Depth of each component of the group.
+    * @param ghosts const IntVector reference indicating the width
+    *              of the ghost cell region around the box over which
+    *              the data will be allocated.
+    *
+    * @pre !component_depths.empty()
+    * @pre each component depth is positive
+    * @pre box.getDim() == ghosts.getDim()
+    * @pre ghosts.min() >= 0
+    */
+   CellDataGroup(
+      const hier::Box& box,
+      const std::vector<int>& component_depths,
+      const hier::IntVector& ghosts);
+
+   /*!
+    * @brief The virtual destructor for a cell data group.
+    */
+   virtual ~CellDataGroup<TYPE>();
+
+   /*!
+    * @brief Return the sum of the given component depths.
+    *
+    * @pre !component_depths.empty()
+    */
+   static int
+   getTotalDepth(
+      const std::vector<int>& component_depths);
+
+   /*!
+    * @brief Return the number of components in the group.
+    */
+   int
+   getNumberOfComponents() const
+   {
+      return static_cast<int>(d_start_depth.size()) - 1;
+   }
+
+   /*!
+    * @brief Return the depth of a component.
+    *
+    * @pre (component >= 0) && (component < getNumberOfComponents())
+    */
+   int
+   getComponentDepth(
+      int component) const
+   {
+      TBOX_ASSERT((component >= 0) && (component < getNumberOfComponents()));
+      return d_start_depth[component + 1] - d_start_depth[component];
+   }
+
+   /*!
+    * @brief Return the depth of the underlying array at which a component
+    * starts.
+    *
+    * @pre (component >= 0) && (component < getNumberOfComponents())
+    */
+   int
+   getStartDepth(
+      int component) const
+   {
+      TBOX_ASSERT((component >= 0) && (component < getNumberOfComponents()));
+      return d_start_depth[component];
+   }
+
+   /*!
+    * @brief Get a pointer to the beginning of a depth of a component.
+    *
+    * @pre (component >= 0) && (component < getNumberOfComponents())
+    * @pre (depth >= 0) && (depth < getComponentDepth(component))
+    */
+   TYPE *
+   getComponentPointer(
+      int component,
+      int depth = 0);
+
+   /*!
+    * @brief Get a const pointer to the beginning of a depth of a
+    * component.
+    *
+    * @pre (component >= 0) && (component < getNumberOfComponents())
+    * @pre (depth >= 0) && (depth < getComponentDepth(component))
+    */
+   const TYPE *
+   getComponentPointer(
+      int component,
+      int depth = 0) const;
+
+   /*!
+    * @brief Return a reference to the data of a component at the given
+    * index and depth of the component.
+    *
+    * @pre (component >= 0) && (component < getNumberOfComponents())
+    * @pre (depth >= 0) && (depth < getComponentDepth(component))
+    */
+   TYPE&
+   operator () (
+      const CellIndex& i,
+      int component,
+      int depth);
+
+   /*!
+    * @brief Return a const reference to the data of a component at the
+    * given index and depth of the component.
+    *
+    * @pre (component >= 0) && (component < getNumberOfComponents())
+    * @pre (depth >= 0) && (depth < getComponentDepth(component))
+    */
+   const TYPE&
+   operator () (
+      const CellIndex& i,
+      int component,
+      int depth) const;
+
+   using CellData<TYPE>::operator ();
+
+private:
+   // Unimplemented copy constructor
+   CellDataGroup(
+      const CellDataGroup&);
+
+   // Unimplemented assignment operator
+   CellDataGroup&
+   operator = (
+      const CellDataGroup&);
+
+   /*!
+    * @brief Start depth of each component, followed by the total depth.
+    */
+   std::vector<int> d_start_depth;
+};
+
+}
+}
+
+#include "SAMRAI/pdat/CellDataGroup.C"
+
+#endif
@@ -0,0 +1,145 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2018 Lawrence Livermore National Security, LLC
+ * Description:   Factory class for creating cell data group objects
+ *
+ ************************************************************************/
+
+#ifndef included_pdat_CellDataGroupFactory
+#define included_pdat_CellDataGroupFactory
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/pdat/CellDataFactory.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace SAMRAI {
+namespace pdat {
+
+/**
+ * Class CellDataGroupFactory is a factory class used to allocate new
+ * instances of CellDataGroup objects.  It is a cell data factory whose
+ * depth is the sum of the component depths, so it may be used wherever a
+ * CellDataFactory is expected.  The factory also holds the component
+ * names, so that applications can find a component by name.
+ *
+ * @see CellDataGroup
+ * @see CellDataFactory
+ */
+
+template<class TYPE>
+class CellDataGroupFactory:public CellDataFactory<TYPE>
+{
+public:
+   /**
+    * The constructor for the cell data group factory class.  The
+    * component names and depths and the ghost cell width give the
+    * defaults for all cell data groups created with this factory.
+    *
+    * @pre !component_names.empty()
+    * @pre component_names.size() == component_depths.size()
+    * @pre each component depth is positive
+    * @pre ghosts.min() >= 0
+    */
+   CellDataGroupFactory(
+      const std::vector<std::string>& component_names,
+      const std::vector<int>& component_depths,
+      const hier::IntVector& ghosts);
+
+   /**
+    * Virtual destructor for the cell data group factory class.
+    */
+   virtual ~CellDataGroupFactory<TYPE>();
+
+   /**
+    * @brief Clone the factory with the same components and the given
+    * ghost cell width.
+    *
+    * @pre getDim() == ghosts.getDim()
+    */
+   virtual std::shared_ptr<hier::PatchDataFactory>
+   cloneFactory(
+      const hier::IntVector& ghosts);
+
+   /**
+    * Virtual factory function to allocate a concrete cell data group
+    * object.  The default information about the object (e.g., ghost cell
+    * width) is taken from the factory.
+    *
+    * @pre getDim() == patch.getDim()
+    */
+   virtual std::shared_ptr<hier::PatchData>
+   allocate(
+      const hier::Patch& patch) const;
+
+   /**
+    * Calculate the amount of memory needed to store the cell data group
+    * object, including object data and dynamically allocated data.
+    *
+    * @pre getDim() == box.getDim()
+    */
+   virtual size_t
+   getSizeOfMemory(
+      const hier::Box& box) const;
+
+   /**
+    * Return the number of components in the group.
+    */
+   int
+   getNumberOfComponents() const
+   {
+      return static_cast<int>(d_component_names.size());
+   }
+
+   /**
+    * Return the index of the component with the given name, or -1 if the
+    * group has no such component.
+    */
+   int
+   getComponentIndex(
+      const std::string& component_name) const;
+
+   /**
+    * Return the name of a component.
+    *
+    * @pre (component >= 0) && (component < getNumberOfComponents())
+    */
+   const std::string&
+   getComponentName(
+      int component) const
+   {
+      TBOX_ASSERT((component >= 0) && (component < getNumberOfComponents()));
+      return d_component_names[component];
+   }
+
+   /**
+    * Return the depth of a component.
+    *
+    * @pre (component >= 0) && (component < getNumberOfComponents())
+    */
+   int
+   getComponentDepth(
+      int component) const
+   {
+      TBOX_ASSERT((component >= 0) && (component < getNumberOfComponents()));
+      return d_component_depths[component];
+   }
+
+private:
+   std::vector<std::string> d_component_names;
+   std::vector<int> d_component_depths;
+
+};
+
+}
+}
+
+#include "SAMRAI/pdat/CellDataGroupFactory.C"
+
+#endif
@@ -17,6 +17,7 @@
 #include "SAMRAI/tbox/Complex.h"
 
 #include <string>
+#include <vector>
 
 namespace SAMRAI {
 namespace pdat {
@@ -30,7 +31,12 @@ namespace pdat {
  * See header file for CellData<TYPE> class for a more detailed
  * description of the data layout.
  *
+ * A variable created with a list of components holds them all in one
+ * CellDataGroup<TYPE> on each patch, so that communication schedules move
+ * the components together.
+ *
  * @see CellData
+ * @see CellDataGroup
  * @see CellDataFactory
  * @see hier::Variable
  */
@@ -49,6 +55,21 @@ public:
       const std::string& name,
       int depth = 1);
 
+   /*!
+    * @brief Create a cell-centered variable object with the given name
+    * whose data is a CellDataGroup of the given components.  The depth
+    * of the variable is the sum of the component depths.
+    *
+    * @pre !component_names.empty()
+    * @pre component_names.size() == component_depths.size()
+    * @pre each component depth is positive
+    */
+   CellVariable(
+      const tbox::Dimension& dim,
+      const std::string& name,
+      const std::vector<std::string>& component_names,
+      const std::vector<int>& component_depths);
+
    /*!
     * @brief Virtual destructor for cell variable objects.
     */
@@ -23,6 +23,7 @@
 
 #include <iostream>
 #include <memory>
+#include <vector>
 
 namespace SAMRAI {
 namespace pdat {
@@ -546,6 +547,20 @@ private:
       tbox::MessageStream& stream,
       const EdgeOverlap& overlap) const;
 
+   /*
+    * Compute the source axis and index of box.lower() and the change in
+    * source index along each axis of box, for the rotated copies of the
+    * data of the given axis.
+    */
+   static void
+   getRotatedIndexMap(
+      int& src_axis,
+      hier::Index& src_lower,
+      std::vector<hier::IntVector>& src_steps,
+      const hier::Box& box,
+      int axis,
+      const hier::Transformation& back_trans);
+
    int d_depth;
 
    std::shared_ptr<ArrayData<TYPE> > d_data[SAMRAI::MAX_DIM_VAL];
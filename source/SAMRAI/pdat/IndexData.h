@@ -91,6 +91,31 @@ class IndexIterator;
  * More information about the templated TYPE is provided in the IndexData
  * README file.
  *
+ * By default IndexData keeps a pointer for every cell of its ghost box,
+ * which makes lookups cheap but uses a lot of memory when only a few
+ * cells of a large patch hold items.  IndexData objects created with
+ * sorted storage instead keep their items in a contiguous array ordered
+ * by the position of their indices in the ghost box, found by binary
+ * search.  With sorted storage:
+ *
+ *    - Iteration is in index order rather than insertion order; the add,
+ *      append and replace versions of the insertion methods are then
+ *      equivalent.
+ *    - The "Pointer" insertion methods copy the item and delete it.
+ *    - Any method inserting or removing items (including copy(),
+ *      unpackStream() and getFromRestart()) invalidates all iterators
+ *      and all pointers to items of the IndexData, since the items may
+ *      move in memory.  Replacing the item at an index that already
+ *      holds one does not.  With the default storage, only iterators and
+ *      pointers to removed or replaced items are invalidated.
+ *    - Inserting an item costs time proportional to the number of items
+ *      after it, so appending items in index order is cheap and many
+ *      items in any order should be inserted together with appendItems().
+ *
+ * Copying, packing and unpacking take time proportional to the number of
+ * items with either storage.  The storage is chosen per variable with the
+ * IndexVariable constructor.
+ *
  * IndexData objects are created by the IndexDataFactory
  * factory object just as all other patch data types.
  *
@@ -104,20 +129,23 @@ class IndexData:public hier::PatchData
 {
 public:
    /**
-    * Define the iterator.
+    * Define the iterator.  See the class description for the changes
+    * to the data that invalidate iterators.
     */
    typedef IndexIterator<TYPE, BOX_GEOMETRY> iterator;
 
    /**
     * The constructor for an IndexData object.  The box describes the interior
     * of the index space and the ghosts vector describes the ghost nodes in
-    * each coordinate direction.
+    * each coordinate direction.  The sorted_storage argument selects the
+    * sorted storage described above.
     *
     * @pre box.getDim() == ghosts.getDim()
     */
    IndexData(
       const hier::Box& box,
-      const hier::IntVector& ghosts);
+      const hier::IntVector& ghosts,
+      bool sorted_storage = false);
 
    /**
     * The virtual destructor for an IndexData object.
@@ -359,6 +387,21 @@ public:
       const hier::Index& index,
       TYPE * item);
 
+   /**
+    * Add new items to the tail of the irregular index set, replacing any
+    * items already located at their indices.  The result is the same as
+    * that of calling appendItem() for each item in turn, but with sorted
+    * storage takes time proportional to the number of items plus
+    * n log(n) for n new items.
+    *
+    * @pre indices.size() == items.size()
+    * @pre each index is in hier::PatchData::getGhostBox()
+    */
+   void
+   appendItems(
+      const std::vector<hier::Index>& indices,
+      const std::vector<TYPE>& items);
+
    /**
     * Remove (deallocate) the item in the irregular index set located at
     * the specified hier::Index.
@@ -437,6 +480,15 @@ public:
    getItem(
       const hier::Index& index) const;
 
+   /**
+    * Return true if the items are kept in sorted storage.
+    */
+   bool
+   usesSortedStorage() const
+   {
+      return d_sorted_storage;
+   }
+
    /**
     * Check to make sure that the class version number is the same
     * as the restart file version number.
@@ -519,6 +571,60 @@ private:
    removeNodeFromList(
       IndexDataNode<TYPE, BOX_GEOMETRY> * node);
 
+   /**
+    * Return the position in sorted storage of the item at the offset, or
+    * the number of items if there is none.
+    */
+   size_t
+   findSortedItem(
+      size_t offset) const;
+
+   /**
+    * Return the position in sorted storage of the first item whose offset
+    * is not less than the given offset.
+    */
+   size_t
+   lowerBoundSortedItem(
+      size_t offset) const;
+
+   /**
+    * Insert an item into sorted storage, replacing any item at the same
+    * offset.
+    */
+   void
+   insertSortedItem(
+      const hier::Index& index,
+      const size_t offset,
+      const TYPE& item);
+
+   /**
+    * Remove the items in sorted storage whose indices are inside (or
+    * outside) the box.
+    */
+   void
+   removeSortedItems(
+      const hier::Box& box,
+      bool inside);
+
+   /**
+    * Return in first and last the positions in sorted storage of the
+    * items whose offsets lie between those of the lower and upper
+    * corners of the box.  Only these items can be inside the box.
+    */
+   void
+   getSortedItemRange(
+      const hier::Box& box,
+      size_t& first,
+      size_t& last) const;
+
+   /**
+    * Link the nodes in sorted storage from position first on to their
+    * items and to each other after the storage has changed there.
+    */
+   void
+   linkSortedNodes(
+      size_t first);
+
    // Unimplemented copy constructor
    IndexData(
       const IndexData&);
@@ -538,6 +644,14 @@ private:
    IndexDataNode<TYPE, BOX_GEOMETRY>* d_list_head;
    IndexDataNode<TYPE, BOX_GEOMETRY>* d_list_tail;
    int d_number_items;
+
+   /*
+    * Sorted storage: nodes and items in order of their offsets in the
+    * ghost box.  The dense array d_data is empty when these are used.
+    */
+   bool d_sorted_storage;
+   std::vector<IndexDataNode<TYPE, BOX_GEOMETRY> > d_sorted_nodes;
+   std::vector<TYPE> d_sorted_items;
 };
 
 /**
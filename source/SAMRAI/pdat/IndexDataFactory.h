@@ -41,10 +41,12 @@ public:
    /**
     * The default constructor for the IndexDataFactory<TYPE, BOX_GEOMETRY>
     * class.  The ghost cell width argument gives the default width for all
-    * irregular data objects created with this factory.
+    * irregular data objects created with this factory.  The sorted_storage
+    * argument selects the storage of the objects; see IndexData.
     */
    explicit IndexDataFactory(
-      const hier::IntVector& ghosts);
+      const hier::IntVector& ghosts,
+      bool sorted_storage = false);
 
    /**
     * Virtual destructor for the irregular data factory class.
@@ -131,6 +133,16 @@ public:
    validCopyTo(
       const std::shared_ptr<hier::PatchDataFactory>& dst_pdf) const;
 
+   /**
+    * Return true if the objects created by this factory keep their items
+    * in sorted storage.
+    */
+   bool
+   usesSortedStorage() const
+   {
+      return d_sorted_storage;
+   }
+
 private:
    IndexDataFactory(
       const IndexDataFactory&);
@@ -138,6 +150,8 @@ private:
    operator = (
       const IndexDataFactory&);
 
+   bool d_sorted_storage;
+
 };
 
 }
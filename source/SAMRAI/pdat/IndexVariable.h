@@ -46,11 +46,15 @@ class IndexVariable:public hier::Variable
 {
 public:
    /**
-    * Create an index variable object with the specified name.
+    * Create an index variable object with the specified name.  If
+    * sorted_storage is true, the data of the variable keeps its items in
+    * a sorted array instead of an array with an entry for every cell,
+    * which suits data with few items per patch; see IndexData.
     */
    IndexVariable(
       const tbox::Dimension& dim,
-      const std::string& name);
+      const std::string& name,
+      bool sorted_storage = false);
 
    /**
     * Virtual destructor for index variable objects.
@@ -23,6 +23,7 @@
 
 #include <iostream>
 #include <memory>
+#include <vector>
 
 namespace SAMRAI {
 namespace pdat {
@@ -462,6 +463,17 @@ private:
       tbox::MessageStream& stream,
       const NodeOverlap& overlap) const;
 
+   /*
+    * Compute the source index of box.lower() and the change in source
+    * index along each axis of box, for the rotated copies.
+    */
+   static void
+   getRotatedIndexMap(
+      hier::Index& src_lower,
+      std::vector<hier::IntVector>& src_steps,
+      const hier::Box& box,
+      const hier::Transformation& back_trans);
+
    int d_depth;
 
    std::shared_ptr<ArrayData<TYPE> > d_data;
@@ -23,6 +23,7 @@
 
 #include <iostream>
 #include <memory>
+#include <vector>
 
 namespace SAMRAI {
 namespace pdat {
@@ -365,6 +366,15 @@ public:
    virtual bool
    canEstimateStreamSizeFromBox() const;
 
+   /*!
+    * @brief Return true if TYPE is double, so the data can be
+    * communicated with reduced precision.
+    *
+    * @see hier::PatchData::packStreamWithPrecision()
+    */
+   virtual bool
+   canPackWithReducedPrecision() const;
+
    /*!
     * @brief Return the number of bytes needed to stream the data
     * in this patch data object lying in the specified box overlap
@@ -597,6 +607,20 @@ private:
       tbox::MessageStream& stream,
       const SideOverlap& overlap) const;
 
+   /*
+    * Compute the source axis and index of box.lower() and the change in
+    * source index along each axis of box, for the rotated copies of the
+    * data of the given axis.
+    */
+   static void
+   getRotatedIndexMap(
+      int& src_axis,
+      hier::Index& src_lower,
+      std::vector<hier::IntVector>& src_steps,
+      const hier::Box& box,
+      int axis,
+      const hier::Transformation& back_trans);
+
    int d_depth;
    hier::IntVector d_directions;
 
@@ -18,7 +18,6 @@
 #include "SAMRAI/pdat/IntegerAttributeId.h"
 #include "SAMRAI/pdat/DoubleAttributeId.h"
 
-#include <list>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -102,6 +101,21 @@ operator << (
  * Since SparseData is derived from hier::PatchData, its interface conforms
  * to the standard interface that PatchData defines.
  *
+ * STORAGE
+ *
+ * The attribute collections are stored by column: each registered double or
+ * integer attribute has one contiguous array holding its value for every
+ * collection in the object, and the Indices are held in a separate index
+ * column.  The collections of an Index are chained through these arrays in
+ * insertion order.  Indices are located through an open-addressing hash
+ * table.  Communication and restart operations move whole column slices
+ * rather than individual collections.
+ *
+ * Removing Indices one at a time leaves their collections in the columns
+ * until a bulk operation (copy, unpackStream) compacts them.  Compaction
+ * invalidates AttributeIterators.  Removing an Index moves the last Index
+ * into its place, so iteration order is not insertion order.
+ *
  * TEMPLATE PARAMETERS
  *
  * The BOX_GEOMETRY template parameter defines the geometry.  It must have
@@ -121,7 +135,6 @@ template<typename BOX_GEOMETRY>
 class SparseData:public hier::PatchData
 {
 private:
-   class Attributes;
    struct index_hash;
 
    template <class T>
@@ -479,9 +492,6 @@ public:
    friend class SparseDataAttributeIterator<BOX_GEOMETRY>;
 private:
    // Internal typedefs
-   typedef std::list<Attributes> AttributeList;
-   typedef std::unordered_map<
-      hier::Index, AttributeList, index_hash> IndexMap;
    typedef std::unordered_map<
       std::string, DoubleAttributeId> DoubleAttrNameMap;
    typedef std::unordered_map<
@@ -503,9 +513,34 @@ private:
    const tbox::Dimension d_dim;
 
    /*
-    * The map of index to attributes.  See typedef above
+    * The index column.  Element e of this object is the Index
+    * d_indices[e]; its attribute collections are the records
+    * d_first_record[e], d_next_record[d_first_record[e]], ... up to
+    * d_last_record[e].  An element without collections has -1 for both.
+    */
+   std::vector<hier::Index> d_indices;
+   std::vector<int> d_first_record;
+   std::vector<int> d_last_record;
+   std::vector<int> d_num_records;
+
+   /*
+    * The attribute columns, indexed [attribute id][record], and the link
+    * from each record to the next record of the same element.
+    */
+   std::vector<std::vector<double> > d_dbl_columns;
+   std::vector<std::vector<int> > d_int_columns;
+   std::vector<int> d_next_record;
+
+   /*
+    * Number of records belonging to removed elements.
     */
-   IndexMap d_index_to_attribute_map;
+   int d_num_dead_records;
+
+   /*
+    * Open-addressing hash table of element numbers (-1 for an empty slot).
+    * The size is zero or a power of two.
+    */
+   std::vector<int> d_hash_table;
 
    /*
     * Registered name to ID maps.  See typedef above
@@ -532,21 +567,116 @@ private:
     *********************************************************************/
 
    /*
-    * Get the attribute list for this index.
+    * Get the first record of the element at this index.
     *
-    * ASSERTION: Dimensions of the <tt>index</tt> and this must be the same.
+    * ASSERTION: The index must be registered in this object.
     */
-   //std::list<Attributes>& _get(const hier::Index& index) const;
-   AttributeList&
+   int
    _get(
       const hier::Index& index) const;
 
    /*
-    * Add this item to the index to attribute map
+    * Return the element at this index, or -1 if there is none.
+    */
+   int
+   _findElement(
+      const hier::Index& index) const;
+
+   /*
+    * Return the element at this index, adding an element without
+    * attribute collections if there is none.
+    */
+   int
+   _insertElement(
+      const hier::Index& index);
+
+   /*
+    * Remove an element, moving the last element into its place.  Its
+    * records are left in the columns as dead records.
     */
    void
-   _add(
-      const typename IndexMap::const_iterator& item_to_add);
+   _eraseElement(
+      int element);
+
+   /*
+    * Return the hash table slot of an element.
+    */
+   size_t
+   _findSlot(
+      int element) const;
+
+   /*
+    * Rebuild the hash table with the given (power of two) size.
+    */
+   void
+   _rehash(
+      size_t table_size);
+
+   /*
+    * Append an attribute collection to the element's list.
+    */
+   void
+   _appendRecord(
+      int element,
+      const double* dvals,
+      const int* ivals);
+
+   /*
+    * Append num_records collections to the element's list, taking
+    * attribute a of collection k from dcolumns[a * stride + k] (and
+    * likewise for the integer attributes).
+    */
+   void
+   _appendRecords(
+      int element,
+      int num_records,
+      const double* dcolumns,
+      const int* icolumns,
+      int stride);
+
+   /*
+    * Replace the element's collections with those of an element of src.
+    */
+   void
+   _copyRecords(
+      int element,
+      const SparseData<BOX_GEOMETRY>& src,
+      int src_element);
+
+   /*
+    * Return true if the collections of the element equal those of an
+    * element of other.
+    */
+   bool
+   _recordsEqual(
+      int element,
+      const SparseData<BOX_GEOMETRY>& other,
+      int other_element) const;
+
+   /*
+    * Rewrite the columns without dead records, with the records of each
+    * element stored contiguously.
+    */
+   void
+   _compactRecords();
+
+   /*
+    * Collect the elements whose Indices lie in the source space of the
+    * overlap, and the number of their records.
+    */
+   void
+   _getOverlapElements(
+      const hier::BoxOverlap& overlap,
+      std::vector<int>& elements,
+      int& num_records) const;
+
+   /*
+    * Print one attribute collection.
+    */
+   void
+   _printRecord(
+      std::ostream& out,
+      int record) const;
 
    /*
     * iterate through the index elements in this object, and if
@@ -558,8 +688,7 @@ private:
       const hier::Box& box);
 
    /*
-    * The index hash function for adding elements to the std::unordered_map's
-    * buckets.
+    * The index hash function for locating elements in the hash table.
     */
    struct index_hash:
       std::unary_function<hier::Index, std::size_t>{
@@ -567,86 +696,6 @@ private:
       operator () (
          const hier::Index& index) const;
    };
-
-   /*
-    * Internal attribute class.  Clients of SparseData will never use this
-    * directly.
-    *
-    * This is intentionally kept as simple an implementation as possible.
-    * We will add complexity if it becomes necessary.
-    */
-   class Attributes
-   {
-public:
-      /**********************************************************************
-      * Constructors, assignment, destructor
-      **********************************************************************/
-      Attributes(
-         const int dsize,
-         const int isize);
-      Attributes(
-         const Attributes& other);
-      Attributes&
-      operator = (
-         const Attributes& rhs);
-      ~Attributes();
-
-      /**********************************************************************
-      * modifiers
-      **********************************************************************/
-      void
-      add(
-         const double * dvals,
-         const int * ivals);
-      void
-      add(
-         const std::vector<double>& dvals,
-         const std::vector<int>& ivals);
-
-      /**********************************************************************
-      * non-modifying operations
-      **********************************************************************/
-      const double *
-      getDoubleAttributes() const;
-      const int *
-      getIntAttributes() const;
-
-      /**********************************************************************
-      * operators (modifying and non-modifying
-      **********************************************************************/
-      double&
-      operator [] (
-         const DoubleAttributeId& id);
-      const double&
-      operator [] (
-         const DoubleAttributeId& id) const;
-      int&
-      operator [] (
-         const IntegerAttributeId& id);
-      const int&
-      operator [] (
-         const IntegerAttributeId& id) const;
-
-      bool
-      operator == (
-         const Attributes& rhs) const;
-
-      /**********************************************************************
-      * output
-      **********************************************************************/
-      void
-      printAttributes(
-         std::ostream& out) const;
-private:
-      // internal typedefs
-      typedef std::vector<double>::const_iterator dbl_iterator;
-      typedef std::vector<int>::const_iterator int_iterator;
-
-      // data members
-      std::vector<double> d_dbl_attrs;
-      std::vector<int> d_int_attrs;
-   };  // end class Attributes
-
 };
 
 /**********************************************************************
@@ -809,12 +858,11 @@ public:
 private:
    friend class SparseData<BOX_GEOMETRY>;
 
-   typedef typename SparseData<BOX_GEOMETRY>::AttributeList AttributeList;
    /**********************************************************************
    * Data members
    **********************************************************************/
    SparseData<BOX_GEOMETRY>* d_data;
-   typename SparseData<BOX_GEOMETRY>::IndexMap::iterator d_iterator;
+   int d_element;
 
    /**********************************************************************
    * private  methods for internal use only since they expose
@@ -822,11 +870,7 @@ private:
    **********************************************************************/
    SparseDataIterator(
       SparseData<BOX_GEOMETRY>& sparse_data,
-      typename SparseData<BOX_GEOMETRY>::IndexMap::iterator iterator);
-
-   void
-   _insert(
-      const typename SparseData<BOX_GEOMETRY>::Attributes& attributes);
+      int element);
 
    /*!
     * @brief prints the contents of this Iterator (Index + all attributes).
@@ -937,15 +981,17 @@ public:
 
 private:
    friend class SparseData<BOX_GEOMETRY>;
-   typedef typename SparseData<BOX_GEOMETRY>::Attributes Attributes;
-   typedef typename SparseData<BOX_GEOMETRY>::AttributeList AttributeList;
 
    SparseDataAttributeIterator(
-      const AttributeList& attributes,
-      const typename AttributeList::iterator& iterator);
+      SparseData<BOX_GEOMETRY>& sparse_data,
+      int record);
 
-   AttributeList d_list;
-   typename AttributeList::iterator d_list_iterator;
+   /*
+    * The record of the attribute collection in the SparseData's columns,
+    * or -1 at the end of the list.
+    */
+   SparseData<BOX_GEOMETRY>* d_data;
+   int d_record;
 
    /*!
     * @brief print the attributes.  Called from the ostream<< operator.
@@ -815,11 +815,11 @@ private:
     * This array is initialized in initializeOperatorState() and
     * deallocated in deallocateOperatorState().  When allocated,
     * it is allocated for the index range [0,d_ln_max], though
-    * the range [0,d_ln_min-1] is not used.  This is okay because
-    * hier::CoarseFineBoundary is a light object before
-    * it is set for a level.
+    * the range [0,d_ln_min-1] is not used.  The boundaries are
+    * owned and cached by the hierarchy.
     */
-   std::vector<std::shared_ptr<hier::CoarseFineBoundary> > d_cf_boundary;
+   std::vector<std::shared_ptr<const hier::CoarseFineBoundary> >
+   d_cf_boundary;
 
    //@}
 
@@ -607,11 +607,11 @@ private:
    /*!
     * @brief The coarse-fine boundary description for level d_ln.
     *
-    * The coarse-fine boundary is computed when the operator
-    * state is initialized.  It is used to allow solves on
-    * levels that are not the coarsest in the hierarchy.
+    * The coarse-fine boundary is obtained from the hierarchy's
+    * cache when the operator state is initialized.  It is used to
+    * allow solves on levels that are not the coarsest in the hierarchy.
     */
-   std::shared_ptr<hier::CoarseFineBoundary> d_cf_boundary;
+   std::shared_ptr<const hier::CoarseFineBoundary> d_cf_boundary;
 
    /*!
     * @brief Robin boundary coefficient object for physical
@@ -14,6 +14,7 @@
 #include "SAMRAI/SAMRAI_config.h"
 #endif
 
+#include "SAMRAI/tbox/OpenMPUtilities.h"
 #include "SAMRAI/tbox/SAMRAI_MPI.h"
 #include "SAMRAI/tbox/Timer.h"
 
@@ -65,6 +66,11 @@ namespace tbox {
  * avoids the "starvation" problem.  See the MPI documentation for a
  * discussion of starvation.
  *
+ * The completion queue is protected by an OpenMP lock, so Members
+ * may be pushed onto and popped from it by different threads.
+ * Staging, destaging and advancing Members must still be done by
+ * one thread at a time.  Independent stages may be used concurrently.
+ *
  * This class supports communication and uses MPI for message passing.
  * If MPI is disabled, the job of this class disappears and the class
  * is effectively empty, except for managing the registration of
@@ -428,7 +434,10 @@ private:
    size_t
    numberOfCompletedMembers() const
    {
-      return d_completed_members.size();
+      TBOX_omp_set_lock(&l_completed_members);
+      const size_t num_completed = d_completed_members.size();
+      TBOX_omp_unset_lock(&l_completed_members);
+      return num_completed;
    }
 
    /*
@@ -443,7 +452,10 @@ private:
    bool
    hasCompletedMembers() const
    {
-      return !d_completed_members.empty();
+      TBOX_omp_set_lock(&l_completed_members);
+      const bool has_completed = !d_completed_members.empty();
+      TBOX_omp_unset_lock(&l_completed_members);
+      return has_completed;
    }
 
    /*!
@@ -452,7 +464,10 @@ private:
    const Member *
    firstCompletedMember() const
    {
-      return d_members[d_completed_members.front()];
+      TBOX_omp_set_lock(&l_completed_members);
+      const Member* first = d_members[d_completed_members.front()];
+      TBOX_omp_unset_lock(&l_completed_members);
+      return first;
    }
 
    /*!
@@ -492,7 +507,9 @@ private:
    void
    clearCompletionQueue()
    {
+      TBOX_omp_set_lock(&l_completed_members);
       d_completed_members.clear();
+      TBOX_omp_unset_lock(&l_completed_members);
    }
 
    /*!
@@ -738,6 +755,12 @@ private:
     */
    std::list<size_t> d_completed_members;
 
+   /*!
+    * @brief OpenMP lock protecting d_completed_members, so that
+    * threads may push and pop completed Members concurrently.
+    */
+   mutable TBOX_omp_lock_t l_completed_members;
+
    /*!
     * @brief Members who has completed their operations.
     */
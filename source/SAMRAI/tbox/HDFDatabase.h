@@ -24,6 +24,7 @@
 #include "SAMRAI/tbox/DatabaseBox.h"
 #include "SAMRAI/tbox/Complex.h"
 #include "SAMRAI/tbox/PIO.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
 
 #ifdef RCSID
 #undef RCSID
@@ -33,6 +34,7 @@
 #include <string>
 #include <list>
 #include <memory>
+#include <vector>
 
 namespace SAMRAI {
 namespace tbox {
@@ -44,6 +46,13 @@ namespace tbox {
  * It is assumed that all processors will access the database in the same
  * manner.  Error reporting is done using the SAMRAI error reporting macros.
  *
+ * Integer, float and double arrays may be stored in chunks compressed with
+ * the deflate filter, optionally preceded by the shuffle filter; see
+ * setCompression().  The compression settings of a database are inherited
+ * by the sub-databases created or opened through it.  The numbers of bytes
+ * of array data written uncompressed and stored in the file are counted
+ * for a database and its sub-databases together.
+ *
  * @see Database
  */
 
@@ -446,6 +455,64 @@ public:
    create(
       const std::string& name);
 
+   /**
+    * Create a new database file for collective access by all processes
+    * of the given communicator, through the MPI-IO driver of HDF5.
+    *
+    * All processes of mpi must call this method, and must take part in
+    * putDatabasesCollectively() and close() for the file.  An error
+    * results if the HDF5 library was built without parallel support;
+    * see supportsCollectiveIO().
+    *
+    * Returns true if successful.
+    *
+    * @param name name of database. Normally a filename.
+    * @param mpi  processes sharing the file
+    *
+    * @pre !name.empty()
+    */
+   bool
+   create(
+      const std::string& name,
+      const SAMRAI_MPI& mpi);
+
+   /**
+    * @brief Return whether files may be created for collective access,
+    * i.e. whether the HDF5 library supports parallel I/O.
+    */
+   static bool
+   supportsCollectiveIO()
+   {
+#if defined(H5_HAVE_PARALLEL) && defined(HAVE_MPI)
+      return true;
+#else
+      return false;
+#endif
+   }
+
+   /**
+    * @brief Collectively write a database held by each process into a
+    * file created with create(const std::string&, const SAMRAI_MPI&).
+    *
+    * The local_db of each process becomes a group of this database with
+    * the key local_db.getName(), so the names must differ between the
+    * processes.  All processes create the groups and datasets of all
+    * processes in rank order, write each dataset with a collective MPI-IO
+    * transfer, in which only its owner selects data, and close the
+    * datasets in the same order.
+    * Only nested databases and integer, float and double entries are
+    * supported.
+    *
+    * All processes sharing the file must call this method.
+    *
+    * @param local_db Database of this process, e.g. a MemoryDatabase
+    *
+    * @pre the file was created for collective access
+    */
+   void
+   putDatabasesCollectively(
+      Database& local_db);
+
    /**
     * Open an existing database file.
     *
@@ -502,6 +569,83 @@ public:
    virtual std::string
    getName();
 
+   /**
+    * @brief Set the compression of integer, float and double arrays put
+    * into this database and the sub-databases created or opened from it
+    * afterwards.
+    *
+    * Arrays of at least 1 KiB are stored in chunks of chunk_size elements
+    * compressed with the deflate filter.  A chunk_size of 0 stores each
+    * array in a single chunk, limited to 4 MiB.  Compression is skipped,
+    * with a warning, if the HDF5 library lacks the deflate filter.  It
+    * does not apply to putDatabasesCollectively().
+    *
+    * @param deflate_level Deflate level from 1 (fastest) to 9 (smallest),
+    *                      or 0 for contiguous, uncompressed arrays
+    * @param shuffle       Whether to shuffle bytes before deflating, which
+    *                      usually improves the compression of numbers
+    * @param chunk_size    Number of array elements per chunk
+    *
+    * @pre (deflate_level >= 0) && (deflate_level <= 9)
+    */
+   void
+   setCompression(
+      int deflate_level,
+      bool shuffle = true,
+      size_t chunk_size = 0);
+
+   /**
+    * @brief Set the compression from an input database.
+    *
+    * The optional input keys are those of setCompression(), with the same
+    * defaults:
+    *
+    * <b> Definitions: </b>
+    *    - \b    deflate_level
+    *       deflate level from 0 (no compression) to 9.
+    *
+    *    - \b    shuffle
+    *       whether to shuffle bytes before deflating.
+    *
+    *    - \b    chunk_size
+    *       number of array elements per chunk, or 0 for a single chunk.
+    *
+    * @param input_db Input database, which may be null
+    */
+   void
+   setCompressionFromInput(
+      const std::shared_ptr<Database>& input_db);
+
+   /**
+    * @brief Return the deflate level of compressed arrays, or 0 if arrays
+    * are not compressed.
+    */
+   int
+   getDeflateLevel() const
+   {
+      return d_deflate_level;
+   }
+
+   /**
+    * @brief Return the number of bytes of array data written to this
+    * database and its sub-databases before compression.
+    */
+   size_t
+   getNumberOfRawBytes() const
+   {
+      return d_byte_counts->d_raw_bytes;
+   }
+
+   /**
+    * @brief Return the number of bytes the array data written to this
+    * database and its sub-databases occupies in the file.
+    */
+   size_t
+   getNumberOfStoredBytes() const
+   {
+      return d_byte_counts->d_stored_bytes;
+   }
+
    /**
     * Return the group_id so VisIt can access an object's HDF database.
     */
@@ -639,6 +783,66 @@ private:
    readAttribute(
       hid_t dataset_id);
 
+   /*!
+    * @brief Create the dataset creation property list of an array with
+    * the current compression settings.
+    *
+    * @param nelements    Number of array elements
+    * @param element_size Size of an array element in the file
+    *
+    * @return H5P_DEFAULT for a contiguous array, or a property list to be
+    * closed by the caller.
+    */
+   hid_t
+   createArrayProperties(
+      size_t nelements,
+      size_t element_size);
+
+   /*!
+    * @brief Add a written array dataset to the byte counts.
+    */
+   void
+   recordArrayBytes(
+      hid_t dataset,
+      size_t raw_bytes);
+
+   /*!
+    * @brief Give a sub-database the compression settings and byte counts
+    * of this database.
+    */
+   void
+   shareSettings(
+      HDFDatabase& sub_database) const;
+
+   /*
+    * An entry of a local database written by putDatabasesCollectively():
+    * the path of the entry from this database, its type key, its number
+    * of elements and the database and key holding it.
+    */
+   struct CollectiveEntry {
+      std::string d_path;
+      int d_type;
+      size_t d_size;
+      Database* d_db;
+      std::string d_key;
+   };
+
+   /*!
+    * @brief Append the entries of a local database, and recursively of
+    * its nested databases, to a list of collectively written entries.
+    *
+    * @param entries  Output list of entries
+    * @param sub_dbs  Output nested databases, kept alive during writing
+    * @param db       Database to describe
+    * @param path     Path of db from this database
+    */
+   void
+   describeCollectiveEntries(
+      std::vector<CollectiveEntry>& entries,
+      std::vector<std::shared_ptr<Database> >& sub_dbs,
+      Database& db,
+      const std::string& path);
+
    struct hdf_complex {
       double re;
       double im;
@@ -683,6 +887,36 @@ private:
     */
    hid_t d_group_id;
 
+   /*!
+    * @brief Communicator of the processes sharing the file
+    *
+    * MPI_COMM_NULL unless the file was created for collective access.
+    */
+   SAMRAI_MPI::Comm d_collective_comm;
+
+   /*
+    * Compression settings; see setCompression().
+    */
+   int d_deflate_level;
+   bool d_shuffle;
+   size_t d_chunk_size;
+
+   /*
+    * Byte counts shared by a database and its sub-databases.
+    */
+   struct ByteCounts {
+      size_t d_raw_bytes;
+      size_t d_stored_bytes;
+   };
+   std::shared_ptr<ByteCounts> d_byte_counts;
+
+   /*
+    * Smallest array, in bytes, that is compressed and largest chunk, in
+    * bytes, created when arrays are stored in a single chunk.
+    */
+   static const size_t s_min_compressed_bytes;
+   static const size_t s_max_single_chunk_bytes;
+
    /*
     * Name of this database object (passed into constructor)
     */
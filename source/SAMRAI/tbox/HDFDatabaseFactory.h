@@ -20,7 +20,9 @@ namespace tbox {
 /**
  * @brief HDFDatabase factory.
  *
- * Builds a new HDFDatabase.
+ * Builds a new HDFDatabase, with the compression settings given to
+ * setCompressionFromInput() if any.  For example, restart files are
+ * compressed by giving the RestartManager a factory with compression.
  */
 class HDFDatabaseFactory:public DatabaseFactory
 {
@@ -54,6 +56,25 @@ public:
    virtual std::shared_ptr<Database>
    allocate(
       const std::string& name);
+
+   /**
+    * @brief Set the input database holding the compression settings of
+    * the databases built.
+    *
+    * See HDFDatabase::setCompressionFromInput() for the input keys.
+    */
+   void
+   setCompressionFromInput(
+      const std::shared_ptr<Database>& input_db)
+   {
+      d_compression_input_db = input_db;
+   }
+
+private:
+   /*
+    * Input database with compression settings, or null.
+    */
+   std::shared_ptr<Database> d_compression_input_db;
 };
 
 }
@@ -46,6 +46,18 @@ public:
     */
    enum StreamMode { Read, Write };
 
+   /*!
+    * @brief Enumeration of the precisions with which packWithPrecision()
+    * can pack double values.
+    *
+    * - FullPrecision packs the values exactly.
+    * - SinglePrecision packs each value as a float, clamping finite
+    *   values beyond the range of float to +/-FLT_MAX.
+    * - BoundedError packs the values quantized to within an absolute
+    *   error bound, using 1, 2 or 4 bytes per value.
+    */
+   enum PackPrecision { FullPrecision, SinglePrecision, BoundedError };
+
    /*!
     * @brief Create a message stream of the specified size and mode
     *
@@ -302,6 +314,63 @@ public:
       }
    }
 
+   /*!
+    * @brief Pack an array of doubles into the stream with the given
+    * precision.
+    *
+    * With BoundedError, the values are quantized to a step of twice
+    * error_bound, relative to their minimum, and packed with the fewest
+    * bytes per value that hold the number of steps spanned by the values.
+    * Values that cannot be quantized this way (a nonpositive error_bound,
+    * non-finite values, or more than 2^32 steps) are packed exactly.
+    *
+    * With SinglePrecision, finite values beyond the range of float are
+    * clamped to +/-FLT_MAX rather than overflowing to infinity, and the
+    * clamping is included in the error returned.
+    *
+    * @return The largest absolute difference between a value and the
+    * value that unpackWithPrecision() will return for it.
+    *
+    * @param[in] data
+    * @param[in] size  Number of values.
+    * @param[in] precision
+    * @param[in] error_bound  Used only with BoundedError.
+    */
+   double
+   packWithPrecision(
+      const double* data,
+      const size_t size,
+      const PackPrecision precision,
+      const double error_bound = 0.0);
+
+   /*!
+    * @brief Unpack an array of doubles packed by packWithPrecision().
+    *
+    * @param[out] data
+    * @param[in] size  Number of values, as given to packWithPrecision().
+    * @param[in] precision  As given to packWithPrecision().
+    */
+   void
+   unpackWithPrecision(
+      double* data,
+      const size_t size,
+      const PackPrecision precision);
+
+   /*!
+    * @brief Static method to get the message stream space needed by
+    * packWithPrecision().
+    *
+    * The size is exact for FullPrecision and SinglePrecision and an upper
+    * bound for BoundedError, whose size depends on the values.
+    *
+    * @param[in] size  Number of values.
+    * @param[in] precision
+    */
+   static size_t
+   getSizeofWithPrecision(
+      const size_t size,
+      const PackPrecision precision);
+
    /*!
     * @brief Print out internal object data.
     *
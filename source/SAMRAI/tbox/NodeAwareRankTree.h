@@ -0,0 +1,304 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2018 Lawrence Livermore National Security, LLC
+ * Description:   Communication tree aware of shared-memory nodes.
+ *
+ ************************************************************************/
+#ifndef included_tbox_NodeAwareRankTree
+#define included_tbox_NodeAwareRankTree
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/tbox/Database.h"
+#include "SAMRAI/tbox/RankTreeStrategy.h"
+
+#include <memory>
+#include <vector>
+
+namespace SAMRAI {
+namespace tbox {
+
+/*!
+ * @brief Implementation of RankTreeStrategy building a two-level tree
+ * that follows the shared-memory node layout of the processes.
+ *
+ * Ranks are grouped by the shared-memory node they run on.  Within
+ * each node, the ranks form a CenteredRankTree rooted at the node's
+ * representative (the member with the lowest index in the RankGroup).
+ * The representatives of all nodes form a second CenteredRankTree,
+ * rooted at the node containing the first rank of the group.  Thus,
+ * only edges between representatives cross the network and every
+ * other edge stays within a node.
+ *
+ * @verbatim
+ *   Node 0: ranks 0-3    Node 1: ranks 4-7    Node 2: ranks 8-11
+ *
+ *                        0
+ *                 /   /     \    \
+ *                2   3       4     8
+ *                |          / \   / \
+ *                1         6   7 10  11
+ *                          |      |
+ *                          5      9
+ * @endverbatim
+ *
+ * A representative's children are its intra-node children (child
+ * numbers 0 and 1) followed by its inter-node children, so the
+ * degree of the tree is 4.
+ *
+ * The node layout must be known before setupTree() is called.  It is
+ * determined either collectively from the MPI library with
+ * discoverNodes() (using MPI_Comm_split_type with
+ * MPI_COMM_TYPE_SHARED) or by declaring that every block of
+ * contiguous ranks of a given size is a node (see setRanksPerNode()).
+ * Without either, each rank is considered its own node and the tree
+ * reduces to a CenteredRankTree with the first rank as the root.
+ *
+ * The node layout is given in terms of the ranks of the communicator
+ * used to determine it.  The RankGroup given to setupTree() must
+ * refer to a communicator congruent with that one.
+ *
+ * <b> Input Parameters </b>
+ *
+ * <b> Definitions: </b>
+ *    - \b    ranks_per_node
+ *       If positive, treat each block of this many contiguous ranks as a
+ *       node instead of querying the MPI library.  This is useful for
+ *       emulating multiple nodes and on systems where the MPI library
+ *       cannot report the node layout.
+ *
+ * <b> Details: </b> <br>
+ * <table>
+ *   <tr>
+ *     <th>parameter</th>
+ *     <th>type</th>
+ *     <th>default</th>
+ *     <th>range</th>
+ *     <th>opt/req</th>
+ *     <th>behavior on restart</th>
+ *   </tr>
+ *   <tr>
+ *     <td>ranks_per_node</td>
+ *     <td>int</td>
+ *     <td>0</td>
+ *     <td>>=0</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ * </table>
+ */
+class NodeAwareRankTree:public RankTreeStrategy
+{
+
+public:
+   /*!
+    * @brief Constructor.
+    *
+    * The node layout is unknown until discoverNodes() or
+    * setRanksPerNode() is called.
+    */
+   NodeAwareRankTree();
+
+   /*!
+    * @brief Constructor determining the node layout from the MPI
+    * library or from input.
+    *
+    * If the input database specifies a positive ranks_per_node, the
+    * node layout is set by setRanksPerNode().  Otherwise, it is
+    * discovered with discoverNodes(), which is collective over mpi.
+    *
+    * @param[in] mpi
+    * @param[in] input_db
+    */
+   explicit NodeAwareRankTree(
+      const SAMRAI_MPI& mpi,
+      const std::shared_ptr<Database>& input_db =
+         std::shared_ptr<Database>());
+
+   /*!
+    * @brief Destructor.
+    *
+    * Deallocate internal data.
+    */
+   ~NodeAwareRankTree();
+
+   /*!
+    * @brief Determine which ranks share a node.
+    *
+    * This method is collective over mpi.  It splits the communicator
+    * by shared-memory domain and gathers the node identities of all
+    * ranks.
+    *
+    * @param[in] mpi
+    */
+   void
+   discoverNodes(
+      const SAMRAI_MPI& mpi);
+
+   /*!
+    * @brief Declare that each block of ranks_per_node contiguous ranks
+    * forms a node, overriding any layout found by discoverNodes().
+    *
+    * This method requires no communication.
+    *
+    * @pre ranks_per_node > 0
+    */
+   void
+   setRanksPerNode(
+      int ranks_per_node);
+
+   /*!
+    * @brief Return the identity of the node running the given rank.
+    *
+    * The node identity is the lowest rank running on that node, or
+    * the rank itself if the node layout is unknown.
+    */
+   int
+   getNodeOf(
+      int rank) const;
+
+   /*!
+    * @brief Set up the tree.
+    *
+    * Set up the tree for the processors in the given RankGroup.
+    * Prepare to provide tree data for the given rank.
+    *
+    * Setting up has linear complexity in the size of the RankGroup
+    * but requires no communication.
+    *
+    * @param[in] rank_group
+    *
+    * @param[in] my_rank The rank whose parent and children are
+    * sought, usually the local process.
+    */
+   void
+   setupTree(
+      const RankGroup& rank_group,
+      int my_rank);
+
+   /*!
+    * @brief Access the rank used to initialize.
+    */
+   int
+   getRank() const {
+      return d_rank;
+   }
+
+   /*!
+    * @brief Access the parent rank.
+    */
+   int
+   getParentRank() const {
+      return d_parent;
+   }
+
+   /*!
+    * @brief Access a child rank.
+    */
+   int
+   getChildRank(unsigned int child_number) const {
+      return (child_number < d_num_children) ?
+             d_children[child_number] : getInvalidRank();
+   }
+
+   /*!
+    * @brief Return the number of children.
+    */
+   unsigned int getNumberOfChildren() const {
+      return d_num_children;
+   }
+
+   /*!
+    * @brief Return the child number, or invalidChildNumber() if is
+    * root of the tree.
+    */
+   unsigned int getChildNumber() const {
+      return d_child_number;
+   }
+
+   /*!
+    * @brief Return the degree of the tree (the maximum number of
+    * children each node may have).
+    */
+   unsigned int getDegree() const {
+      return 4;
+   }
+
+   /*!
+    * @brief Return the generation number.
+    */
+   unsigned int getGenerationNumber() const {
+      return d_generation;
+   }
+
+   /*!
+    * @brief Return the rank of the root of the tree.
+    */
+   int getRootRank() const {
+      return d_root_rank;
+   }
+
+   /*!
+    * @brief Return whether the local process is the representative
+    * of its node, and thus has inter-node edges.
+    */
+   bool isNodeRepresentative() const {
+      return d_is_representative;
+   }
+
+private:
+   // Unimplemented copy constructor.
+   NodeAwareRankTree(
+      const NodeAwareRankTree& other);
+
+   // Unimplemented assignment operator.
+   NodeAwareRankTree&
+   operator = (
+      const NodeAwareRankTree& rhs);
+
+   /*!
+    * @brief Read input parameters.
+    */
+   void
+   getFromInput(
+      const std::shared_ptr<Database>& input_db);
+
+   /*!
+    * @brief Node identity of each rank, indexed by rank, as set by
+    * discoverNodes().  Empty if unknown.
+    */
+   std::vector<int> d_node_of_rank;
+
+   /*!
+    * @brief Number of ranks per node, if set by setRanksPerNode().
+    */
+   int d_ranks_per_node;
+
+   /*!
+    * @brief Initialized rank.
+    */
+   int d_rank;
+
+   int d_parent;
+
+   int d_children[4];
+
+   int d_root_rank;
+
+   unsigned int d_num_children;
+
+   unsigned int d_child_number;
+
+   unsigned int d_generation;
+
+   bool d_is_representative;
+
+};
+
+}
+}
+
+#endif  // included_tbox_NodeAwareRankTree
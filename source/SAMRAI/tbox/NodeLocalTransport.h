@@ -0,0 +1,263 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2018 Lawrence Livermore National Security, LLC
+ * Description:   Shared-memory transport between processes on a node.
+ *
+ ************************************************************************/
+#ifndef included_tbox_NodeLocalTransport
+#define included_tbox_NodeLocalTransport
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/tbox/OpenMPUtilities.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+#include "SAMRAI/tbox/StartupShutdownManager.h"
+
+#include <map>
+#include <vector>
+
+namespace SAMRAI {
+namespace tbox {
+
+/*!
+ * @brief Shared-memory buffers through which processes on the same
+ * node exchange message data without going through MPI messages.
+ *
+ * Each process owns a segment of an MPI-3 shared-memory window
+ * (MPI_Win_allocate_shared) spanning the processes of its node.  A
+ * sender writes packed data into its own segment, which every other
+ * process on the node maps directly, and notifies the receiver of
+ * where the data is with a small MPI message.  The receiver unpacks
+ * straight from the sender's segment and acknowledges through an
+ * acknowledgement slot in that segment.
+ *
+ * Data is written in epochs.  An epoch is begun by beginEpoch(),
+ * which waits until the receivers have acknowledged all data of the
+ * previous epoch before reusing the segment, and ended by endEpoch().
+ * Only one epoch may be in progress at a time; a Schedule that cannot
+ * begin an epoch sends its data through MPI instead.
+ *
+ * A transport is set up for a communicator by initialize(), which
+ * must be called collectively over that communicator.  Schedules
+ * using that communicator pick it up with getTransport().  All
+ * transports are freed when SAMRAI shuts down.
+ *
+ * If the MPI library predates MPI-3 or MPI is not used, initialize()
+ * does nothing and getTransport() returns a null pointer.
+ *
+ * @see Schedule
+ */
+class NodeLocalTransport
+{
+public:
+   /*!
+    * @brief Set up a transport for the given communicator.
+    *
+    * This method is collective over mpi.  It has no effect if a
+    * transport already exists for the communicator.
+    *
+    * @param[in] mpi
+    * @param[in] buffer_size Number of bytes each process may have
+    * in transit to processes on its node during an epoch.
+    */
+   static void
+   initialize(
+      const SAMRAI_MPI& mpi,
+      size_t buffer_size);
+
+   /*!
+    * @brief Get the transport for the given communicator, or a null
+    * pointer if initialize() was not called for it.
+    */
+   static NodeLocalTransport *
+   getTransport(
+      const SAMRAI_MPI& mpi);
+
+   /*!
+    * @brief Whether the given rank of the transport's communicator
+    * shares a node with the local process.
+    */
+   bool
+   isOnNode(
+      int rank) const
+   {
+      return d_node_rank[rank] >= 0;
+   }
+
+   /*!
+    * @brief Begin an epoch of writing to the local segment.
+    *
+    * Wait until all data written in the previous epoch has been
+    * acknowledged.
+    *
+    * @return False if an epoch is already in progress, in which case
+    * the caller must not write to the segment.
+    */
+   bool
+   beginEpoch();
+
+   /*!
+    * @brief End the current epoch.
+    */
+   void
+   endEpoch();
+
+   /*!
+    * @brief Return the number of the current epoch.
+    */
+   unsigned long int
+   getEpoch() const
+   {
+      return d_epoch;
+   }
+
+   /*!
+    * @brief Reserve space in the local segment for data going to the
+    * given rank.
+    *
+    * @param[in] rank  Receiving rank, which must be on the node.
+    * @param[in] num_bytes
+    * @param[out] offset  Offset of the reserved space, to be given
+    * to the receiver.
+    *
+    * @return Pointer to the reserved space, or a null pointer if the
+    * segment does not have enough space left in this epoch.
+    *
+    * @pre isOnNode(rank)
+    */
+   char *
+   reserve(
+      int rank,
+      size_t num_bytes,
+      size_t& offset);
+
+   /*!
+    * @brief Make data written into the local segment visible to the
+    * other processes on the node.
+    *
+    * Call this before notifying receivers of the data.
+    */
+   void
+   publish() const;
+
+   /*!
+    * @brief Get the data written by the given rank at the given
+    * offset in its segment.
+    *
+    * @pre isOnNode(rank)
+    */
+   const char *
+   getPeerData(
+      int rank,
+      size_t offset) const;
+
+   /*!
+    * @brief Acknowledge to the given rank that the local process is
+    * done with the data it wrote in the given epoch.
+    *
+    * @pre isOnNode(rank)
+    */
+   void
+   acknowledge(
+      int rank,
+      unsigned long int epoch) const;
+
+private:
+   explicit NodeLocalTransport(
+      const SAMRAI_MPI& mpi,
+      size_t buffer_size);
+
+   ~NodeLocalTransport();
+
+   // Unimplemented copy constructor.
+   NodeLocalTransport(
+      const NodeLocalTransport& other);
+
+   // Unimplemented assignment operator.
+   NodeLocalTransport&
+   operator = (
+      const NodeLocalTransport& rhs);
+
+   /*!
+    * @brief Return the acknowledgement slots at the start of the
+    * segment of the process with the given node-local rank.
+    */
+   volatile unsigned long int *
+   getAckSlots(
+      int node_rank) const
+   {
+      return reinterpret_cast<volatile unsigned long int *>(
+         d_segments[node_rank]);
+   }
+
+   /*!
+    * @brief Free all transports.
+    */
+   static void
+   shutdownCallback();
+
+   /*!
+    * @brief Communicator spanning the processes on the local node.
+    */
+   SAMRAI_MPI::Comm d_node_comm;
+
+   SAMRAI_MPI::Win d_win;
+
+   /*!
+    * @brief Node-local rank of each rank of the transport's
+    * communicator, or -1 for ranks on other nodes.
+    */
+   std::vector<int> d_node_rank;
+
+   /*!
+    * @brief Start of the segment of each process on the node, indexed
+    * by node-local rank.
+    */
+   std::vector<char *> d_segments;
+
+   /*!
+    * @brief Size of the acknowledgement slot area at the start of
+    * each segment.
+    */
+   size_t d_header_size;
+
+   /*!
+    * @brief Size of the data area following the acknowledgement slots.
+    */
+   size_t d_buffer_size;
+
+   /*!
+    * @brief Epoch in which data was last written for each process on
+    * the node, indexed by node-local rank.
+    */
+   std::vector<unsigned long int> d_sent_epoch;
+
+   int d_my_node_rank;
+
+   unsigned long int d_epoch;
+
+   bool d_in_epoch;
+
+   /*!
+    * @brief OpenMP lock for claiming the epoch.
+    */
+   TBOX_omp_lock_t l_epoch;
+
+   /*!
+    * @brief Offset of the unreserved part of the data area.
+    */
+   size_t d_offset;
+
+   static std::map<SAMRAI_MPI::Comm, NodeLocalTransport *> s_transports;
+
+   static StartupShutdownManager::Handler s_shutdown_handler;
+
+};
+
+}
+}
+
+#endif  // included_tbox_NodeLocalTransport
@@ -73,12 +73,39 @@ namespace tbox {
  * both a restart directory name and a restore number for its arguments.
  * See comments for member functions for more details.
  *
+ * Objects that write files from a background thread, such as a VisIt
+ * data writer in staged mode, register themselves as a BackgroundWriter.
+ * Their writes are completed before a restart file is written, so that
+ * restart I/O never overlaps them.
+ *
  * @see Database
  */
 
 class RestartManager
 {
 public:
+   /**
+    * Interface of objects writing files from a background thread.
+    */
+   class BackgroundWriter
+   {
+public:
+      BackgroundWriter()
+      {
+      }
+
+      virtual ~BackgroundWriter()
+      {
+      }
+
+      /**
+       * Return when the files being written in the background are
+       * complete.
+       */
+      virtual void
+      waitForBackgroundWrites() = 0;
+   };
+
    /**
     * Return a pointer to the single instance of the restart manager.
     * All access to the restart manager object is through getManager().
@@ -198,6 +225,24 @@ public:
    unregisterRestartItem(
       const std::string& name);
 
+   /**
+    * Registers an object whose background writes must be complete
+    * before a restart file is written.  Registering an object twice has
+    * no effect.
+    *
+    * @pre writer != 0
+    */
+   void
+   registerBackgroundWriter(
+      BackgroundWriter* writer);
+
+   /**
+    * Removes an object from the background writers.
+    */
+   void
+   unregisterBackgroundWriter(
+      BackgroundWriter* writer);
+
    /**
     * Clear all restart items managed by the restart manager.
     */
@@ -292,6 +337,12 @@ private:
    writeRestartFile(
       const std::shared_ptr<Database>& database);
 
+   /*
+    * Wait for the writes of all background writers.
+    */
+   void
+   waitForBackgroundWriters();
+
    /*
     * Create the directory structure for the data files.
     * The directory structure created is
@@ -326,6 +377,11 @@ private:
     */
    std::list<RestartManager::RestartItem> d_restart_items_list;
 
+   /*
+    * objects whose background writes are completed before writing restart
+    */
+   std::list<BackgroundWriter *> d_background_writers;
+
    std::shared_ptr<Database> d_database_root;
 
    /*
@@ -63,7 +63,17 @@ enum {
    MPI_MAXLOC,
    MPI_SUM,
    // Attributes:
-   MPI_TAG_UB
+   MPI_TAG_UB,
+   // Communicator split types:
+   MPI_COMM_TYPE_SHARED,
+   // One-sided communication:
+   MPI_WIN_NULL,
+   MPI_MODE_NOCHECK,
+   // Thread support levels, in increasing order:
+   MPI_THREAD_SINGLE,
+   MPI_THREAD_FUNNELED,
+   MPI_THREAD_SERIALIZED,
+   MPI_THREAD_MULTIPLE
 };
 #endif
 
@@ -119,12 +129,16 @@ public:
    typedef MPI_Op Op;
    typedef MPI_Request Request;
    typedef MPI_Status Status;
+   typedef MPI_Win Win;
+   typedef MPI_Aint Aint;
 #else
    typedef int Comm;
    typedef int Datatype;
    typedef int Group;
    typedef int Op;
    typedef int Request;
+   typedef int Win;
+   typedef long Aint;
 
    /*!
     * @brief Dummy definition of Status to match the MPI standard.
@@ -442,6 +456,37 @@ public:
       int* array_of_indices,
       Status* array_of_statuses);
 
+   /*!
+    * @brief MPI-3 shared-memory window wrappers.
+    *
+    * These return an error code other than MPI_SUCCESS if the MPI
+    * library predates MPI-3.
+    */
+   static int
+   Win_shared_query(
+      Win win,
+      int rank,
+      Aint* size,
+      int* disp_unit,
+      void* baseptr);
+
+   static int
+   Win_lock_all(
+      int assert,
+      Win win);
+
+   static int
+   Win_unlock_all(
+      Win win);
+
+   static int
+   Win_sync(
+      Win win);
+
+   static int
+   Win_free(
+      Win* win);
+
    /*!
     * @brief MPI Wtime (if MPI is enabled) or an alternate time
     * calculation.
@@ -498,6 +543,15 @@ public:
       Datatype datatype,
       Op op) const;
 
+   int
+   Alltoall(
+      void* sendbuf,
+      int sendcount,
+      Datatype sendtype,
+      void* recvbuf,
+      int recvcount,
+      Datatype recvtype) const;
+
    int
    Attr_get(
       int keyval,
@@ -510,6 +564,16 @@ public:
    int
    Barrier() const;
 
+   /*!
+    * @brief MPI Ibarrier.
+    *
+    * Returns an error code other than MPI_SUCCESS if the MPI library
+    * predates MPI-3.
+    */
+   int
+   Ibarrier(
+      Request* request) const;
+
    /*!
     * @brief MPI Bcast (does nothing when MPI is disabled).
     */
@@ -524,6 +588,25 @@ public:
    Comm_dup(
       Comm* newcomm) const;
 
+   int
+   Comm_split(
+      int color,
+      int key,
+      Comm* newcomm) const;
+
+   /*!
+    * @brief MPI Comm_split_type.
+    *
+    * With MPI implementations older than MPI-3, which lack
+    * MPI_Comm_split_type, each process is put into its own
+    * communicator.
+    */
+   int
+   Comm_split_type(
+      int split_type,
+      int key,
+      Comm* newcomm) const;
+
    /*!
     * @brief MPI Comm_rank (Set rank to 0 when MPI is disabled).
     */
@@ -538,6 +621,19 @@ public:
    Comm_size(
       int* size) const;
 
+   /*!
+    * @brief MPI Win_allocate_shared.
+    *
+    * Returns an error code other than MPI_SUCCESS if the MPI library
+    * predates MPI-3.
+    */
+   int
+   Win_allocate_shared(
+      Aint size,
+      int disp_unit,
+      void* baseptr,
+      Win* win) const;
+
    int
    Gather(
       void* sendbuf,
@@ -575,6 +671,15 @@ public:
       int tag,
       Request* req) const;
 
+   int
+   Issend(
+      void* buf,
+      int count,
+      Datatype datatype,
+      int dest,
+      int tag,
+      Request* req) const;
+
    int
    Irecv(
       void* buf,
@@ -848,14 +953,23 @@ public:
     * SAMRAI_MPI object with a communicator duplicated from
     * MPI_COMM_WORLD.
     *
+    * To execute Schedules concurrently from multiple threads, request
+    * MPI_THREAD_MULTIPLE.  MPI is then started with MPI_Init_thread.
+    * If the library provides less than the requested level, a warning
+    * is printed and getThreadLevel() reports the level provided.
+    *
     * Use only one of the three initialization methods.
     *
     * @param[in]  argc  Pointer to parameter from main()
     * @param[in]  argv  Pointer to parameter from main()
+    * @param[in]  required_thread_level  Level of thread support
+    * required (MPI_THREAD_SINGLE, MPI_THREAD_FUNNELED,
+    * MPI_THREAD_SERIALIZED or MPI_THREAD_MULTIPLE).
     */
    static void init(
       int* argc,
-      char** argv[]);
+      char** argv[],
+      int required_thread_level = MPI_THREAD_SINGLE);
 
    /*!
     * @brief Initialize SAMRAI_MPI when MPI is already initialized.
@@ -882,6 +996,18 @@ public:
    static void
    initMPIDisabled();
 
+   /*!
+    * @brief Level of thread support provided by the MPI library.
+    *
+    * When MPI is not used, there is no restriction on threads and
+    * MPI_THREAD_MULTIPLE is returned.
+    */
+   static int
+   getThreadLevel()
+   {
+      return s_thread_level;
+   }
+
    /*!
     * @brief Shut down SAMRAI_MPI and, if appropriate, shut down MPI.
     *
@@ -948,6 +1074,11 @@ private:
     */
    static bool s_we_started_mpi;
 
+   /*!
+    * @brief Level of thread support provided by MPI.
+    */
+   static int s_thread_level;
+
    /*!
     * @brief Primary SAMRAI_MPI object.
     */
@@ -16,6 +16,7 @@
 #include "SAMRAI/tbox/AsyncCommStage.h"
 #include "SAMRAI/tbox/SAMRAI_MPI.h"
 #include "SAMRAI/tbox/MessageStream.h"
+#include "SAMRAI/tbox/NodeLocalTransport.h"
 #include "SAMRAI/tbox/Transaction.h"
 
 #include <iostream>
@@ -48,7 +49,23 @@ namespace tbox {
  * order of transaction execution matters.  The transactions will be
  * executed in the order in which they appear in the list.
  *
+ * If a NodeLocalTransport has been initialized for the schedule's
+ * communicator, data going to processes on the same node is written
+ * into shared memory and only its location is sent through MPI.  See
+ * setNodeLocalTransportFlag().
+ *
+ * Different Schedule objects may be executed concurrently by the
+ * threads of an OpenMP parallel region, provided MPI was initialized
+ * with MPI_THREAD_MULTIPLE (see SAMRAI_MPI::init()).  Thread t offsets
+ * the schedule's MPI tags by t times the thread_tag_stride (2 by
+ * default, settable in the "Schedule" input database), so matching
+ * schedules must be executed by threads with the same number on all
+ * processes, as with a statically scheduled loop.  Schedules must be
+ * created, and their timer prefixes set, outside of parallel regions.
+ * Timers only record the work of the master thread.
+ *
  * @see Transaction
+ * @see NodeLocalTransport
  */
 
 class Schedule
@@ -248,6 +265,21 @@ public:
       d_unpack_in_deterministic_order = flag;
    }
 
+   /*!
+    * @brief Set whether to exchange data with processes on the same
+    * node through the NodeLocalTransport of the communicator, if one
+    * has been initialized.
+    *
+    * The default is true.  The flag must have the same value on all
+    * processes executing the schedule.
+    *
+    * @param [in] flag
+    */
+   void setNodeLocalTransportFlag(bool flag)
+   {
+      d_use_node_local_transport = flag;
+   }
+
    /*!
     * @brief Setup names of timers.
     *
@@ -308,8 +340,22 @@ private:
    void
    processCompletedCommunications();
    void
+   unpackReceivedMessage(
+      AsyncCommPeer<char>& completed_comm);
+   void
    deallocateSendBuffers();
 
+   /*!
+    * @brief Whether data exchanged with the given rank goes through
+    * d_node_local.
+    */
+   bool
+   isNodeLocal(
+      int rank) const
+   {
+      return d_node_local != 0 && d_node_local->isOnNode(rank);
+   }
+
    Schedule(
       const Schedule&);                 // not implemented
    Schedule&
@@ -400,10 +446,42 @@ private:
     */
    bool d_unpack_in_deterministic_order;
 
+   /*!
+    * @brief Whether to use the NodeLocalTransport of d_mpi.
+    *
+    * @see setNodeLocalTransportFlag()
+    */
+   bool d_use_node_local_transport;
+
+   /*!
+    * @brief NodeLocalTransport used in the current communication
+    * phase, or null if none.
+    */
+   NodeLocalTransport* d_node_local;
+
+   /*!
+    * @brief Whether this schedule holds the current epoch of
+    * d_node_local and can write into its segment.
+    */
+   bool d_node_local_epoch;
+
    static const int s_default_first_tag;
    static const int s_default_second_tag;
    static const size_t s_default_first_message_length;
 
+   /*!
+    * @brief Leading byte of messages to processes on the same node,
+    * telling whether the data follows in the message or was written
+    * into the sender's shared-memory segment.
+    */
+   static const char s_node_local_inline;
+   static const char s_node_local_shared;
+
+   /*!
+    * @brief Offset between the MPI tags used by consecutive threads.
+    */
+   static int s_thread_tag_stride;
+
    //@{
    //! @name Timer data for Schedule class.
 
@@ -447,7 +525,8 @@ private:
 
    /*!
     * @brief Get all the timers defined in TimerStruct.  The timers
-    * are named with the given prefix.
+    * are named with the given prefix.  Only the master thread records
+    * time in them (see Timer).
     */
    static void
    getAllTimers(
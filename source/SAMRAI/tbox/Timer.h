@@ -53,6 +53,13 @@ class TimerManager;
  * an input file or it was not explicitly made active by the user.  When
  * a timer is created, it is active by default.
  *
+ * Only the master thread records time.  Calls to start() and stop(),
+ * and the barriers of barrierAndStart() and barrierAndStop(), are
+ * ignored on the other threads of an OpenMP parallel region, because
+ * a timer and the TimerManager's stack of running timers may not be
+ * modified by several threads at once.  Work done by those threads is
+ * thus timed only as part of an enclosing timer of the master thread.
+ *
  * Note that the constructor is protected so that timer objects can only
  * be created by the TimerManager class.
  *
@@ -91,11 +91,34 @@ public:
    getCoarsenOpStencilWidth(
       const tbox::Dimension& dim) const = 0;
 
+   /*!
+    * @brief Return whether the coarsen hooks of this strategy may run for
+    * all of the patches of a level around batched coarsen operations.
+    *
+    * By default a CoarsenSchedule calls preprocessCoarsen(), the coarsen
+    * operators and postprocessCoarsen() for one fine patch before moving
+    * on to the next one.  If this function returns true, the schedule
+    * instead calls preprocessCoarsen() for every fine patch of the level,
+    * then coarsens the level with one hier::CoarsenOperator::coarsenBatch()
+    * call per coarsen item, then calls postprocessCoarsen() for every fine
+    * patch.  Return true only if the hooks of one patch do not depend on
+    * the coarsened data of another.
+    *
+    * The default implementation returns false.
+    */
+   virtual bool
+   allowsBatchedCoarsen() const
+   {
+      return false;
+   }
+
    /*!
     * @brief Perform user-defined patch data coarsening operations.
     *
     * This member function is called before standard coarsening operations
     * (expressed using concrete subclasses of the CoarsenOperator base class).
+    * If allowsBatchedCoarsen() returns true, this function is called for
+    * every patch of the level before any of them is coarsened.
     * The preprocess function should move data from the source components
     * on the fine patch into the source components on the coarse patch
     * in the specified coarse box region.  Recall that the source components
@@ -120,6 +143,8 @@ public:
     *
     * This member function is called after standard coarsening operations
     * (expressed using concrete subclasses of the CoarsenOperator base class).
+    * If allowsBatchedCoarsen() returns true, this function is called for
+    * every patch of the level after all of them are coarsened.
     * The postprocess function should move data from the source components on
     * the fine patch into the source components on the coarse patch in the
     * specified coarse box region.  Recall that the source components are
@@ -0,0 +1,221 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2018 Lawrence Livermore National Security, LLC
+ * Description:   Fill pattern restricted to selected patch faces
+ *
+ ************************************************************************/
+
+#ifndef included_xfer_DirectionalVariableFillPattern
+#define included_xfer_DirectionalVariableFillPattern
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/BoxGeometry.h"
+#include "SAMRAI/hier/BoxOverlap.h"
+#include "SAMRAI/xfer/VariableFillPattern.h"
+
+#include <memory>
+#include <string>
+
+namespace SAMRAI {
+namespace xfer {
+
+/*!
+ * @brief Class DirectionalVariableFillPattern is a concrete implementation
+ * of the abstract base class VariableFillPattern that fills only the ghost
+ * regions across selected faces of a patch.
+ *
+ * Overlaps are computed by the geometries' own overlap calculation, as in
+ * BoxGeometryVariableFillPattern, and then restricted to the patch interior
+ * and to the strips of ghost data lying across the faces selected by a face
+ * mask.  Each strip spans the patch box in the directions normal to its face
+ * and extends the stencil width away from the face.  Edges and corners of
+ * the ghost region are not filled.
+ *
+ * Face masks are formed by combining the values returned by getFaceMask()
+ * and getDirectionMask() with bitwise or.  For example, an operator that
+ * only reads ghost data in the x direction during a dimension-split sweep
+ * would use getDirectionMask(0).
+ *
+ * @see RefineAlgorithm::getDirectionalSchedule()
+ */
+
+class DirectionalVariableFillPattern:
+   public VariableFillPattern
+{
+public:
+   /*!
+    * @brief Constructor
+    *
+    * @param[in] stencil_width  Width of the ghost strips to fill
+    * @param[in] face_mask      Faces whose ghost strips are filled
+    *
+    * @pre face_mask < (1U << 2 * stencil_width.getDim().getValue())
+    */
+   DirectionalVariableFillPattern(
+      const hier::IntVector& stencil_width,
+      unsigned int face_mask);
+
+   /*!
+    * @brief Destructor
+    */
+   virtual ~DirectionalVariableFillPattern();
+
+   /*!
+    * @brief Return the mask selecting one face of a patch.
+    *
+    * @param[in] direction  Coordinate direction normal to the face
+    * @param[in] side       0 for the lower face, 1 for the upper face
+    *
+    * @pre direction < SAMRAI::MAX_DIM_VAL
+    * @pre side == 0 || side == 1
+    */
+   static unsigned int
+   getFaceMask(
+      unsigned short direction,
+      int side)
+   {
+      TBOX_ASSERT(direction < SAMRAI::MAX_DIM_VAL);
+      TBOX_ASSERT(side == 0 || side == 1);
+      return 1U << (2 * direction + side);
+   }
+
+   /*!
+    * @brief Return the mask selecting both faces of a patch normal to the
+    * given coordinate direction.
+    *
+    * @pre direction < SAMRAI::MAX_DIM_VAL
+    */
+   static unsigned int
+   getDirectionMask(
+      unsigned short direction)
+   {
+      return getFaceMask(direction, 0) | getFaceMask(direction, 1);
+   }
+
+   /*!
+    * @brief Calculate overlap between the destination and source geometries
+    * representing the fill pattern.
+    *
+    * This will return the portion of the intersection of the geometries
+    * that lies in the interior of the patch (if overwrite_interior is true)
+    * or in the ghost strips across the selected faces of the patch.  The
+    * patch is identified by the argument dst_patch_box.
+    *
+    * @param[in] dst_geometry    geometry object for destination box
+    * @param[in] src_geometry    geometry object for source box
+    * @param[in] dst_patch_box   box for the destination patch
+    * @param[in] src_mask        the source mask, the box resulting from
+    *                            transforming the source box
+    * @param[in] fill_box        the box to be filled
+    * @param[in] overwrite_interior  controls whether or not to include the
+    *                                destination box interior in the overlap.
+    * @param[in] transformation  the transformation from source to
+    *                            destination index space.
+    *
+    * @return                std::shared_ptr to the calculated overlap object
+    *
+    * @pre dst_patch_box.getDim() == src_mask.getDim()
+    */
+   std::shared_ptr<hier::BoxOverlap>
+   calculateOverlap(
+      const hier::BoxGeometry& dst_geometry,
+      const hier::BoxGeometry& src_geometry,
+      const hier::Box& dst_patch_box,
+      const hier::Box& src_mask,
+      const hier::Box& fill_box,
+      const bool overwrite_interior,
+      const hier::Transformation& transformation) const;
+
+   /*!
+    * Computes a BoxOverlap object which defines the space to be filled by
+    * a refinement operation.  For this implementation, that space is the
+    * intersection between fill_boxes (computed by the RefineSchedule),
+    * data_box, which specifies the extent of the destination data, and the
+    * patch interior together with the ghost strips across the selected
+    * faces.  The patch data factory is used to compute the overlap with the
+    * appropriate data centering.
+    *
+    * @param[in] fill_boxes  list representing the all of the space on a patch
+    *                        or its ghost region that may be filled by a
+    *                        refine operator (cell-centered representation)
+    * @param[in] node_fill_boxes node-centered representation of fill_boxes
+    * @param[in] patch_box   box representing the patch where a refine operator
+    *                        will fill data.  (cell-centered representation)
+    * @param[in] data_box    box representing the full extent of the region
+    *                        covered by a patch data object, including all
+    *                        ghosts (cell-centered representation)
+    * @param[in] pdf         patch data factory for the data that is to be
+    *                        filled
+    */
+   std::shared_ptr<hier::BoxOverlap>
+   computeFillBoxesOverlap(
+      const hier::BoxContainer& fill_boxes,
+      const hier::BoxContainer& node_fill_boxes,
+      const hier::Box& patch_box,
+      const hier::Box& data_box,
+      const hier::PatchDataFactory& pdf) const;
+
+   /*!
+    * @brief Return the width of the ghost strips given to the constructor.
+    */
+   const hier::IntVector&
+   getStencilWidth();
+
+   /*!
+    * @brief Return the face mask given to the constructor.
+    */
+   unsigned int
+   getFaceMask() const
+   {
+      return d_face_mask;
+   }
+
+   /*!
+    * @brief Returns a string name identifier "DIRECTIONAL_FILL_PATTERN_"
+    * followed by the face mask.
+    *
+    * The name differs for different face masks so that refine items
+    * using different masks are not treated as equivalent.
+    */
+   const std::string&
+   getPatternName() const;
+
+private:
+   DirectionalVariableFillPattern(
+      const DirectionalVariableFillPattern&);           // not implemented
+   DirectionalVariableFillPattern&
+   operator = (
+      const DirectionalVariableFillPattern&);           // not implemented
+
+   /*!
+    * @brief Compute the boxes covering the patch interior and the ghost
+    * strips across the selected faces.
+    *
+    * @param[out] stencil_boxes  Output boxes
+    * @param[in]  dst_box        Patch box
+    */
+   void
+   computeStencilBoxes(
+      hier::BoxContainer& stencil_boxes,
+      const hier::Box& dst_box) const;
+
+   hier::IntVector d_stencil_width;
+
+   unsigned int d_face_mask;
+
+   std::string d_name_id;
+
+   /*!
+    * Static string containing string name identifier prefix for this class
+    */
+   static const std::string s_name_id;
+};
+
+}
+}
+
+#endif
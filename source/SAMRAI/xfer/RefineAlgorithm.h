@@ -17,6 +17,7 @@
 #include "SAMRAI/hier/RefineOperator.h"
 #include "SAMRAI/xfer/RefinePatchStrategy.h"
 #include "SAMRAI/xfer/RefineSchedule.h"
+#include "SAMRAI/xfer/RefineScheduleCache.h"
 #include "SAMRAI/hier/TimeInterpolateOperator.h"
 #include "SAMRAI/xfer/VariableFillPattern.h"
 #include "SAMRAI/hier/Connector.h"
@@ -25,7 +26,9 @@
 #include "SAMRAI/hier/PatchHierarchy.h"
 #include "SAMRAI/hier/PatchLevel.h"
 
+#include <map>
 #include <memory>
+#include <vector>
 
 namespace SAMRAI {
 namespace xfer {
@@ -112,12 +115,21 @@ namespace xfer {
  * as long as the patches involved in the communication process do not change;
  * thus, they can be used for multiple data communication cycles.
  *
+ * Operators that read ghost data only across some faces of a patch can use
+ * getDirectionalSchedule() to get a schedule filling just those parts of the
+ * ghost region.
+ *
+ * Algorithms creating structurally identical schedules may share them
+ * through a RefineScheduleCache given to setScheduleCache().
+ *
  * @see RefineSchedule
  * @see RefinePatchStrategy
  * @see RefineClasses
+ * @see RefineScheduleCache
  */
 
-class RefineAlgorithm
+class RefineAlgorithm:
+   public hier::PatchHierarchy::LevelChangeStrategy
 {
 public:
    /*!
@@ -132,7 +144,7 @@ public:
    /*!
     * @brief The destructor releases all internal storage.
     */
-   ~RefineAlgorithm();
+   virtual ~RefineAlgorithm();
 
    /*!
     * @brief Register a refine operation with the refine algorithm object.
@@ -158,6 +170,15 @@ public:
     *                              the NULL default is used, then class
     *                              BoxGeometryVariableFillPattern will be used
     *                              internally.
+    * @param[in] work_ids  Patch data indices of work space data.
+    * @param[in] pack_precision  Precision with which CellData<double> and
+    *                            SideData<double> are packed into messages
+    *                            between processes (see
+    *                            tbox::MessageStream::PackPrecision).  Data
+    *                            of other types and local copies are always
+    *                            exact.
+    * @param[in] pack_error_bound  Absolute error bound used when
+    *                              pack_precision is BoundedError.
     *
     * @pre !d_schedule_created
     */
@@ -169,7 +190,10 @@ public:
       const std::shared_ptr<hier::RefineOperator>& oprefine,
       const std::shared_ptr<VariableFillPattern>& var_fill_pattern =
          std::shared_ptr<VariableFillPattern>(),
-      const std::vector<int>& work_ids = std::vector<int>());
+      const std::vector<int>& work_ids = std::vector<int>(),
+      const tbox::MessageStream::PackPrecision pack_precision =
+         tbox::MessageStream::FullPrecision,
+      const double pack_error_bound = 0.0);
 
    /*!
     * @brief Register a refine operation with the refine algorithm object.
@@ -203,6 +227,28 @@ public:
     *                              the NULL default is used, then class
     *                              BoxGeometryVariableFillPattern will be used
     *                              internally.
+    * @param[in] work_ids  Patch data indices of work space data.
+    * @param[in] pack_precision  Precision with which CellData<double> and
+    *                            SideData<double> are packed into messages
+    *                            between processes (see
+    *                            tbox::MessageStream::PackPrecision).  Data
+    *                            of other types and local copies are always
+    *                            exact.
+    * @param[in] pack_error_bound  Absolute error bound used when
+    *                              pack_precision is BoundedError.
+    * @param[in] optime_refine  Optional operator fusing optime and oprefine
+    *                           (see hier::TimeRefineOperator).  Where the
+    *                           coarse data needed to fill a destination
+    *                           patch lies in the interior of one local
+    *                           source patch away from the physical boundary,
+    *                           the schedule skips time interpolating that
+    *                           data into a coarse temporary and instead
+    *                           applies this operator directly to the old and
+    *                           new source data.  In those places the coarse
+    *                           scratch data given to the RefinePatchStrategy
+    *                           refine hooks is not filled, so this operator
+    *                           should only be used when those hooks do not
+    *                           read it.  The result is otherwise the same.
     *
     * @pre optime
     * @pre !d_schedule_created
@@ -218,7 +264,12 @@ public:
       const std::shared_ptr<hier::TimeInterpolateOperator>& optime,
       const std::shared_ptr<VariableFillPattern>& var_fill_pattern =
          std::shared_ptr<VariableFillPattern>(),
-      const std::vector<int>& work_ids = std::vector<int>());
+      const std::vector<int>& work_ids = std::vector<int>(),
+      const tbox::MessageStream::PackPrecision pack_precision =
+         tbox::MessageStream::FullPrecision,
+      const double pack_error_bound = 0.0,
+      const std::shared_ptr<hier::TimeRefineOperator>& optime_refine =
+         std::shared_ptr<hier::TimeRefineOperator>());
 
    /*!
     * @brief Create a communication schedule for communicating data within a
@@ -594,6 +645,128 @@ public:
       const std::shared_ptr<RefineTransactionFactory>& transaction_factory =
          std::shared_ptr<RefineTransactionFactory>());
 
+   /*!
+    * @brief Set the cache in which createSchedule() looks up and stores
+    * schedules.
+    *
+    * Algorithms given the same cache share schedules whose levels and
+    * other creation arguments are the same and whose registered operations
+    * are identical (see RefineScheduleCache).  A cached schedule is never
+    * reset to another algorithm's operations, so it may be held and reused
+    * like any other schedule.  A null pointer (the default) disables
+    * caching.
+    *
+    * @param[in] cache
+    */
+   void
+   setScheduleCache(
+      const std::shared_ptr<RefineScheduleCache>& cache)
+   {
+      d_schedule_cache = cache;
+   }
+
+   /*!
+    * @brief Return the cache set by setScheduleCache().
+    */
+   const std::shared_ptr<RefineScheduleCache>&
+   getScheduleCache() const
+   {
+      return d_schedule_cache;
+   }
+
+   /*!
+    * @brief Get a schedule that fills only the ghost data across the patch
+    * faces selected by face_mask, creating it if needed.
+    *
+    * The schedule performs the operations registered with this algorithm,
+    * except that every item uses a DirectionalVariableFillPattern with the
+    * given face mask and a strip width equal to the ghost width of the
+    * item's scratch data.  Ghost data across unselected faces, and along
+    * edges and corners, is left untouched.  This lets operators that read
+    * ghost data in one direction at a time, such as dimension-split
+    * sweeps, communicate only the strips they need.
+    *
+    * Schedules are cached per destination level and face mask, so one
+    * algorithm may be used on several levels.  A cached schedule is
+    * returned as long as it was created with the same hierarchy, coarser
+    * level, patch strategy, time refinement flag and transaction factory;
+    * otherwise a new schedule replaces it.
+    *
+    * A cached schedule holds the patches of its levels, and with them
+    * every patch of those levels (see PatchLevel).  The algorithm
+    * therefore registers itself with the given hierarchy and releases the
+    * cached schedules created with it as soon as their level or coarser
+    * level is replaced in or removed from the hierarchy.  Without a
+    * hierarchy there is no way to tell that a level was replaced, so such
+    * schedules are kept until they are released by
+    * clearDirectionalSchedules().
+    *
+    * @param[in] face_mask  Faces to fill.  See
+    *                       DirectionalVariableFillPattern::getFaceMask()
+    *                       and
+    *                       DirectionalVariableFillPattern::getDirectionMask().
+    * @param[in] level      std::shared_ptr to destination patch level.
+    * @param[in] next_coarser_level  Level number of next coarser patch level
+    *                                in hierarchy, or -1 to fill from the
+    *                                destination level only.
+    * @param[in] hierarchy  std::shared_ptr to patch hierarchy.  This pointer
+    *                       may be null only when next_coarser_level is < 0.
+    * @param[in] patch_strategy
+    * @param[in] use_time_interpolation
+    * @param[in] transaction_factory
+    *
+    * @pre level
+    * @pre (next_coarser_level == -1) || hierarchy
+    * @pre !hierarchy || (level->getDim() == hierarchy->getDim())
+    */
+   std::shared_ptr<RefineSchedule>
+   getDirectionalSchedule(
+      unsigned int face_mask,
+      const std::shared_ptr<hier::PatchLevel>& level,
+      const int next_coarser_level = -1,
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy =
+         std::shared_ptr<hier::PatchHierarchy>(),
+      RefinePatchStrategy* patch_strategy = 0,
+      bool use_time_interpolation = false,
+      const std::shared_ptr<RefineTransactionFactory>& transaction_factory =
+         std::shared_ptr<RefineTransactionFactory>());
+
+   /*!
+    * @brief Release all schedules cached by getDirectionalSchedule().
+    *
+    * Cached schedules keep their levels alive, so this may be called after
+    * regridding to free the old levels before the schedules are next used.
+    */
+   void
+   clearDirectionalSchedules()
+   {
+      d_directional_schedules.clear();
+   }
+
+   /*!
+    * @brief Release the schedules cached by getDirectionalSchedule() for
+    * the given destination level.
+    *
+    * @param[in] level
+    */
+   void
+   clearDirectionalSchedules(
+      const std::shared_ptr<hier::PatchLevel>& level);
+
+   /*!
+    * @brief Release the schedules cached by getDirectionalSchedule() that
+    * use a level no longer current in its hierarchy.
+    *
+    * Called by the hierarchies the schedules were created with.
+    *
+    * @param[in]  patch_hierarchy
+    * @param[in]  level_number
+    */
+   void
+   levelChanged(
+      const hier::PatchHierarchy& patch_hierarchy,
+      int level_number);
+
    /*!
     * @brief Given a previously-generated refine schedule, check for
     * consistency with this refine algorithm object to see whether a call to
@@ -690,6 +863,66 @@ private:
     */
    bool d_schedule_created;
 
+   /*!
+    * @brief Return the schedule in the schedule cache for the request, or
+    * a null pointer if there is none or no cache is set.
+    */
+   std::shared_ptr<RefineSchedule>
+   findCachedSchedule(
+      const RefineScheduleCache::Request& request) const;
+
+   /*!
+    * @brief Store a newly created schedule in the schedule cache, if set.
+    */
+   void
+   cacheSchedule(
+      const RefineScheduleCache::Request& request,
+      const std::shared_ptr<RefineSchedule>& schedule) const;
+
+   /*!
+    * Cache in which schedules are looked up and stored, if set.
+    */
+   std::shared_ptr<RefineScheduleCache> d_schedule_cache;
+
+   /*!
+    * @brief A schedule cached by getDirectionalSchedule() and the
+    * arguments it was created with.
+    */
+   struct DirectionalSchedule {
+      std::shared_ptr<RefineSchedule> d_schedule;
+      std::weak_ptr<hier::PatchLevel> d_level;
+      std::weak_ptr<hier::PatchLevel> d_coarser_level;
+      std::weak_ptr<hier::PatchHierarchy> d_hierarchy;
+      int d_next_coarser_level;
+      RefinePatchStrategy* d_patch_strategy;
+      bool d_use_time_interpolation;
+      std::shared_ptr<RefineTransactionFactory> d_transaction_factory;
+   };
+
+   /*!
+    * @brief Release the schedules cached by getDirectionalSchedule() whose
+    * levels are no longer current in their hierarchy.
+    */
+   void
+   removeStaleDirectionalSchedules();
+
+   /*!
+    * Key of a schedule created by getDirectionalSchedule(): destination
+    * level and face mask.
+    */
+   typedef std::pair<const hier::PatchLevel *, unsigned int> DirectionalKey;
+
+   /*!
+    * Schedules created by getDirectionalSchedule().
+    */
+   std::map<DirectionalKey, DirectionalSchedule> d_directional_schedules;
+
+   /*!
+    * Hierarchies this algorithm is registered with as a
+    * LevelChangeStrategy.
+    */
+   std::vector<std::weak_ptr<hier::PatchHierarchy> > d_level_change_hierarchies;
+
 };
 
 }
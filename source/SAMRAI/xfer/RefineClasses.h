@@ -15,6 +15,8 @@
 
 #include "SAMRAI/hier/RefineOperator.h"
 #include "SAMRAI/hier/TimeInterpolateOperator.h"
+#include "SAMRAI/hier/TimeRefineOperator.h"
+#include "SAMRAI/tbox/MessageStream.h"
 #include "SAMRAI/xfer/VariableFillPattern.h"
 
 #include <iostream>
@@ -98,6 +100,12 @@ public:
        */
       std::shared_ptr<hier::TimeInterpolateOperator> d_optime;
 
+      /*!
+       * @brief Optional operator fusing d_optime and d_oprefine.  It is
+       * null unless the item uses time interpolation.
+       */
+      std::shared_ptr<hier::TimeRefineOperator> d_optime_refine;
+
       /*!
        * @brief Index of equivalence class where this item belongs.  All
        * items of the same equivalence class will have the same value.
@@ -115,6 +123,17 @@ public:
        * filled by the RefineSchedule.
        */
       std::shared_ptr<VariableFillPattern> d_var_fill_pattern;
+
+      /*!
+       * @brief Precision with which data is packed into messages between
+       * processes.  Local copies are always exact.
+       */
+      tbox::MessageStream::PackPrecision d_pack_precision;
+
+      /*!
+       * @brief Absolute error bound for BoundedError packing.
+       */
+      double d_pack_error_bound;
    };
 
    /*!
@@ -345,8 +364,8 @@ public:
     *    <li> The refinement operator ptr d_oprefine must be null or non-null
     *         for both objects.  If non-null, both operators must have the
     *         same stencil width.
-    *    <li> The type of the d_var_fill_pattern must be the same for both
-    *         objects.
+    *    <li> The type and pattern name of the d_var_fill_pattern must be
+    *         the same for both objects.
     * </ul>
     *
     * If a null patch descriptor argument is passed (or ommitted), the
@@ -127,6 +127,48 @@ public:
    getRefineOpStencilWidth(
       const tbox::Dimension& dim) const = 0;
 
+   /*!
+    * @brief Return whether the refine hooks of this strategy may be used
+    * with fused time interpolation and refinement.
+    *
+    * When a refine item has a hier::TimeRefineOperator, a RefineSchedule
+    * may refine directly from the old and new source data and leave the
+    * time interpolated coarse scratch data of the item unfilled.  The
+    * coarse patch passed to preprocessRefine(), postprocessRefine() and
+    * their box and level variants then holds no valid scratch data for
+    * that item.  Schedules only fuse time interpolation and refinement if
+    * this function returns true, meaning the hooks never read the coarse
+    * scratch data of time interpolated items.
+    *
+    * The default implementation returns false.
+    */
+   virtual bool
+   allowsFusedTimeRefine() const
+   {
+      return false;
+   }
+
+   /*!
+    * @brief Return whether the refine hooks of this strategy may run for
+    * all of the patches of a level around batched refine operations.
+    *
+    * By default a RefineSchedule calls preprocessRefineBoxes(), the refine
+    * operators and postprocessRefineBoxes() for one coarse patch before
+    * moving on to the next one.  If this function returns true, the
+    * schedule instead calls preprocessRefineBoxes() for every coarse patch
+    * of the level, then refines the level with one
+    * hier::RefineOperator::refineBatch() call per refine item, then calls
+    * postprocessRefineBoxes() for every coarse patch.  Return true only if
+    * the hooks of one patch do not depend on the refined data of another.
+    *
+    * The default implementation returns false.
+    */
+   virtual bool
+   allowsBatchedRefine() const
+   {
+      return false;
+   }
+
    /*!
     * @brief Perform user-defined patch data refinement operations.
     *
@@ -177,6 +219,8 @@ public:
     *
     * This member function is called before standard refining operations
     * (expressed using concrete subclasses of the RefineOperator base class).
+    * If allowsBatchedRefine() returns true, this function is called for
+    * every coarse patch of the level before any of them is refined.
     *
     * The default implementation of this virtual function loops over the
     * box list and calls the preprocessRefine() method for a single box.
@@ -209,6 +253,8 @@ public:
     *
     * This member function is called after standard refining operations
     * (expressed using concrete subclasses of the RefineOperator base class).
+    * If allowsBatchedRefine() returns true, this function is called for
+    * every coarse patch of the level after all of them are refined.
     *
     * The default implementation of this virtual function loops over the
     * box list and calls the postprocessRefine() method for a single box.
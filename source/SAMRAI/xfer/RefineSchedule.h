@@ -22,10 +22,12 @@
 #include "SAMRAI/hier/IntVector.h"
 #include "SAMRAI/hier/PatchHierarchy.h"
 #include "SAMRAI/hier/PatchLevel.h"
+#include "SAMRAI/tbox/OpenMPUtilities.h"
 #include "SAMRAI/tbox/Schedule.h"
 #include "SAMRAI/tbox/Timer.h"
 
 #include <iostream>
+#include <map>
 #include <memory>
 
 namespace SAMRAI {
@@ -218,12 +220,41 @@ public:
     *                            RefineAlgorithm object.  This pointer must be
     *                            non-null.
     *
+    * It is an error to reset a schedule for which setResetDisabled(true)
+    * has been called, such as a schedule shared through a
+    * RefineScheduleCache.
+    *
     * @pre refine_classes
+    * @pre !isResetDisabled()
     */
    void
    reset(
       const std::shared_ptr<RefineClasses>& refine_classes);
 
+   /*!
+    * @brief Disable or enable reset().
+    *
+    * A schedule held by several owners is disabled so that no owner can
+    * change the data moved for the others.
+    *
+    * @param[in] disabled
+    */
+   void
+   setResetDisabled(
+      bool disabled)
+   {
+      d_reset_disabled = disabled;
+   }
+
+   /*!
+    * @brief Return whether reset() is disabled.
+    */
+   bool
+   isResetDisabled() const
+   {
+      return d_reset_disabled;
+   }
+
    /*!
     * @brief Execute the stored communication schedule and perform
     * the data movement.
@@ -322,6 +353,55 @@ public:
    printClassData(
       std::ostream& stream) const;
 
+   /*!
+    * @brief Add to the statistics of data sent with reduced precision
+    * (see RefineAlgorithm::registerRefine()).
+    *
+    * This is called by the refine transactions when they pack data,
+    * possibly from several threads at once.
+    *
+    * @param[in] full_bytes  Bytes the data would take at full precision.
+    * @param[in] packed_bytes  Bytes actually packed.
+    * @param[in] max_error  Largest absolute error introduced by the packing.
+    */
+   static void
+   addReducedPrecisionPacking(
+      size_t full_bytes,
+      size_t packed_bytes,
+      double max_error);
+
+   /*!
+    * @brief Record the statistics of data sent with reduced precision
+    * since the last call, on this process, with tbox::Statistician.
+    *
+    * The process statistics "RefineSchedule_reduced_precision_bytes_saved"
+    * and "RefineSchedule_reduced_precision_max_error" hold the bytes
+    * saved and the largest error introduced by packing.
+    */
+   static void
+   recordReducedPrecisionStatistics();
+
+   /*!
+    * @brief Return the bytes saved by reduced precision packing on this
+    * process since the last recordReducedPrecisionStatistics().
+    */
+   static double
+   getReducedPrecisionBytesSaved()
+   {
+      return s_reduced_precision_full_bytes - s_reduced_precision_packed_bytes;
+   }
+
+   /*!
+    * @brief Return the largest error introduced by reduced precision
+    * packing on this process since the last
+    * recordReducedPrecisionStatistics().
+    */
+   static double
+   getReducedPrecisionMaxError()
+   {
+      return s_reduced_precision_max_error;
+   }
+
 private:
    /*
     * Static integer constant describing the largest possible ghost cell width.
@@ -548,6 +628,8 @@ private:
     * @param[in] coarse_to_unfilled  Connector coarse to level representing
     *                                boxes that need to be filled.
     * @param[in] overlaps
+    * @param[in] fill_time           Time to which data is interpolated by
+    *                                fused time refine operators.
     */
    void
    refineScratchData(
@@ -556,7 +638,34 @@ private:
       const hier::Connector& coarse_to_fine,
       const hier::Connector& coarse_to_unfilled,
       const std::vector<std::vector<std::shared_ptr<hier::BoxOverlap> > >&
-      overlaps) const;
+      overlaps,
+      double fill_time) const;
+
+   /*!
+    * @brief Refine a refine item onto a fine patch with its fused time
+    * refine operator, if the coarse patch was left unfilled for it.
+    *
+    * @param[in] ref_item
+    * @param[in] time_refine_sources  Map from coarse patches left unfilled
+    *                                 to their source patches, or 0 if the
+    *                                 item is not time refined here.
+    * @param[in,out] fine_patch
+    * @param[in] crse_patch
+    * @param[in] refine_overlap
+    * @param[in] ratio
+    * @param[in] fill_time
+    *
+    * @return Whether the item was refined.
+    */
+   bool
+   timeRefineFromSource(
+      const RefineClasses::Data& ref_item,
+      const std::map<hier::BoxId, hier::BoxId>* time_refine_sources,
+      hier::Patch& fine_patch,
+      const hier::Patch& crse_patch,
+      const hier::BoxOverlap& refine_overlap,
+      const hier::IntVector& ratio,
+      double fill_time) const;
 
    /*!
     * @brief Compute and store the BoxOverlaps that will be needed by
@@ -1153,6 +1262,18 @@ private:
     */
    std::shared_ptr<RefineSchedule> d_coarse_interp_schedule;
 
+   /*!
+    * @brief Destination patches whose time interpolation is fused with the
+    * refinement done by the parent schedule, indexed by refine item tag.
+    *
+    * For each item with a fused time refine operator, maps the id of a
+    * destination box to the id of the local source box whose interior
+    * holds all of its data.  No transactions are created for these pairs;
+    * the parent schedule instead applies the fused operator to the source
+    * patch in refineScratchData().  Only set in recursive schedules.
+    */
+   std::vector<std::map<hier::BoxId, hier::BoxId> > d_time_refine_sources;
+
    /*!
     * @brief Schedule to recursively fill d_coarse_interp_encon_level using
     * the next coarser hierarchy level.
@@ -1324,6 +1445,11 @@ private:
    hier::ComponentSelector d_coarse_encon_encon_work_vector;
    bool d_internal_allocated;
 
+   /*!
+    * @brief Whether reset() is disabled.  See setResetDisabled().
+    */
+   bool d_reset_disabled;
+
    /*!
     * @brief Shared debug checking flag.
     */
@@ -1340,6 +1466,22 @@ private:
     */
    static bool s_read_static_input;
 
+   //@{
+   /*!
+    * @name Statistics of data sent with reduced precision since the last
+    * recordReducedPrecisionStatistics().
+    */
+   static double s_reduced_precision_full_bytes;
+   static double s_reduced_precision_packed_bytes;
+   static double s_reduced_precision_max_error;
+
+   /*!
+    * @brief Lock serializing updates of the statistics by transactions
+    * packing in different threads.
+    */
+   static TBOX_omp_lock_t l_reduced_precision_statistics;
+   //@}
+
    //@{
    /*!
     * @name Timer objects for performance measurement.
@@ -0,0 +1,324 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2018 Lawrence Livermore National Security, LLC
+ * Description:   Cache of refine schedules shared by refine algorithms
+ *
+ ************************************************************************/
+
+#ifndef included_xfer_RefineScheduleCache
+#define included_xfer_RefineScheduleCache
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/PatchHierarchy.h"
+#include "SAMRAI/hier/PatchLevel.h"
+#include "SAMRAI/tbox/Statistic.h"
+#include "SAMRAI/xfer/PatchLevelFillPattern.h"
+#include "SAMRAI/xfer/RefineClasses.h"
+#include "SAMRAI/xfer/RefinePatchStrategy.h"
+#include "SAMRAI/xfer/RefineSchedule.h"
+#include "SAMRAI/xfer/RefineTransactionFactory.h"
+
+#include <list>
+#include <memory>
+#include <string>
+#include <typeinfo>
+
+namespace SAMRAI {
+namespace xfer {
+
+/*!
+ * @brief Class RefineScheduleCache keeps refine schedules created for the
+ * levels of a patch hierarchy so that structurally identical schedules are
+ * built only once.
+ *
+ * Creating a RefineSchedule involves bridging Connectors and constructing
+ * transactions, which is expensive compared to resetting an existing
+ * schedule.  Applications often create schedules with the same
+ * characteristics many times between regrids, e.g. from several
+ * integrators registering equivalent operations.  A RefineAlgorithm given a
+ * cache through RefineAlgorithm::setScheduleCache() looks up its
+ * createSchedule() requests in the cache.  A request is satisfied from the
+ * cache if an earlier request had:
+ *
+ * <ul>
+ *    <li> the same destination, source and coarser levels (the same
+ *         PatchLevel objects),
+ *    <li> identical refine classes: the same RefineClasses object, or
+ *         classes whose items are the same, item for item, in their patch
+ *         data ids, flags, operators and variable fill patterns,
+ *    <li> a PatchLevelFillPattern of the same type,
+ *    <li> the same transaction factory, patch strategy and time refinement
+ *         flag.
+ * </ul>
+ *
+ * A cached schedule may be handed to several holders, so it must not be
+ * reset to other refine classes: that would change the data moved by
+ * every other holder.  Cached schedules therefore have reset disabled
+ * (see RefineSchedule::setResetDisabled()), and RefineSchedule::reset()
+ * reports an error for them.  A request whose classes merely match those
+ * of a cached schedule (see RefineClasses::classesMatch()) is satisfied
+ * by resetting that schedule only when the cache is its sole holder,
+ * which is much cheaper than building a new one.  Otherwise a new
+ * schedule is built and cached as well.
+ *
+ * Only schedules whose levels are current levels of the cache's hierarchy
+ * are cached.  The cache keys refer to levels and hierarchy through weak
+ * pointers.  The cache registers itself with the hierarchy as a
+ * hier::PatchHierarchy::LevelChangeStrategy and discards a cached
+ * schedule as soon as any of its levels is replaced or removed, e.g. by
+ * regridding, so that the cache does not keep old levels alive.
+ * Schedules for levels not in the hierarchy are created normally and not
+ * cached.
+ *
+ * Hits, resets and misses are counted and may be recorded as processor
+ * statistics named <object_name>_hits, <object_name>_resets and
+ * <object_name>_misses with recordStatistics().
+ *
+ * @see RefineAlgorithm
+ */
+
+class RefineScheduleCache:
+   public hier::PatchHierarchy::LevelChangeStrategy
+{
+public:
+   /*!
+    * @brief Characteristics of a schedule request, used as the cache key.
+    *
+    * The two constructors correspond to the two kinds of RefineSchedule:
+    * those filling from a source level only and those also filling from
+    * coarser levels of a hierarchy.
+    */
+   struct Request {
+      Request(
+         const std::shared_ptr<PatchLevelFillPattern>& fill_pattern,
+         const std::shared_ptr<hier::PatchLevel>& dst_level,
+         const std::shared_ptr<hier::PatchLevel>& src_level,
+         RefinePatchStrategy* patch_strategy,
+         bool use_time_refinement,
+         const std::shared_ptr<RefineTransactionFactory>& transaction_factory);
+
+      Request(
+         const std::shared_ptr<PatchLevelFillPattern>& fill_pattern,
+         const std::shared_ptr<hier::PatchLevel>& dst_level,
+         const std::shared_ptr<hier::PatchLevel>& src_level,
+         int next_coarser_level,
+         const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+         RefinePatchStrategy* patch_strategy,
+         bool use_time_refinement,
+         const std::shared_ptr<RefineTransactionFactory>& transaction_factory);
+
+      bool d_fill_from_coarser;
+      const std::type_info* d_fill_pattern_type;
+      std::weak_ptr<hier::PatchLevel> d_dst_level;
+      std::weak_ptr<hier::PatchLevel> d_src_level;
+      bool d_has_src_level;
+      int d_next_coarser_level;
+      std::weak_ptr<hier::PatchHierarchy> d_hierarchy;
+      bool d_has_hierarchy;
+      RefinePatchStrategy* d_patch_strategy;
+      bool d_use_time_refinement;
+      std::shared_ptr<RefineTransactionFactory> d_transaction_factory;
+   };
+
+   /*!
+    * @brief Constructor.
+    *
+    * @param[in] object_name  Name used for the statistics.
+    * @param[in] hierarchy    Hierarchy whose levels schedules are cached for.
+    *
+    * @pre hierarchy
+    */
+   RefineScheduleCache(
+      const std::string& object_name,
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy);
+
+   /*!
+    * @brief Destructor.
+    */
+   ~RefineScheduleCache();
+
+   /*!
+    * @brief Find a cached schedule for the given request that uses
+    * refine classes identical to the given ones.
+    *
+    * Failing that, a cached schedule for the request whose classes match
+    * the given ones and that is held by no one but the cache is reset to
+    * the given classes and returned.
+    *
+    * @return The cached schedule, or a null pointer if the request is not
+    * cacheable or no cached schedule can be used for it.
+    *
+    * @pre refine_classes
+    */
+   std::shared_ptr<RefineSchedule>
+   findSchedule(
+      const Request& request,
+      const std::shared_ptr<RefineClasses>& refine_classes);
+
+   /*!
+    * @brief Cache a schedule created for the given request.
+    *
+    * The schedule is not cached if the request is not cacheable.
+    * Otherwise its reset is disabled.
+    *
+    * @pre schedule
+    */
+   void
+   insertSchedule(
+      const Request& request,
+      const std::shared_ptr<RefineSchedule>& schedule);
+
+   /*!
+    * @brief Discard all cached schedules.
+    */
+   void
+   clear()
+   {
+      d_entries.clear();
+   }
+
+   /*!
+    * @brief Return the number of cached schedules.
+    */
+   int
+   getNumberOfSchedules() const
+   {
+      return static_cast<int>(d_entries.size());
+   }
+
+   /*!
+    * @brief Return the number of requests satisfied from the cache.
+    */
+   int
+   getNumberOfHits() const
+   {
+      return d_num_hits;
+   }
+
+   /*!
+    * @brief Return the number of requests satisfied by resetting a cached
+    * schedule.
+    */
+   int
+   getNumberOfResets() const
+   {
+      return d_num_resets;
+   }
+
+   /*!
+    * @brief Return the number of cacheable requests not satisfied from the
+    * cache.
+    */
+   int
+   getNumberOfMisses() const
+   {
+      return d_num_misses;
+   }
+
+   /*!
+    * @brief Discard schedules with a level that is no longer in the
+    * hierarchy, releasing the schedule's references to it.
+    */
+   void
+   removeStaleEntries();
+
+   /*!
+    * @brief Discard the schedules made stale by the change of a level.
+    *
+    * @param[in] patch_hierarchy
+    * @param[in] level_number
+    */
+   void
+   levelChanged(
+      const hier::PatchHierarchy& patch_hierarchy,
+      int level_number);
+
+   /*!
+    * @brief Record the current hit, reset and miss counts as processor
+    * statistics in the tbox::Statistician.
+    */
+   void
+   recordStatistics();
+
+private:
+   RefineScheduleCache(
+      const RefineScheduleCache&);              // not implemented
+   RefineScheduleCache&
+   operator = (
+      const RefineScheduleCache&);              // not implemented
+
+   struct Entry {
+      Entry(
+         const Request& request,
+         const std::shared_ptr<RefineSchedule>& schedule);
+
+      Request d_request;
+      std::weak_ptr<hier::PatchLevel> d_coarser_level;
+      std::shared_ptr<RefineSchedule> d_schedule;
+   };
+
+   /*!
+    * @brief Return whether the given level is currently in the hierarchy.
+    */
+   bool
+   isCurrentLevel(
+      const std::shared_ptr<hier::PatchLevel>& level) const;
+
+   /*!
+    * @brief Return whether schedules for the request may be cached.
+    */
+   bool
+   isCacheable(
+      const Request& request) const;
+
+   /*!
+    * @brief Return whether the given entry is for the given request.
+    */
+   bool
+   isSameRequest(
+      const Request& cached,
+      const Request& request) const;
+
+   /*!
+    * @brief Return whether two refine classes describe exactly the same
+    * operations, so that one schedule performs both.
+    */
+   static bool
+   classesAreIdentical(
+      const std::shared_ptr<RefineClasses>& classes1,
+      const std::shared_ptr<RefineClasses>& classes2);
+
+   /*!
+    * @brief Return the coarser level a request fills from, if any.
+    */
+   std::shared_ptr<hier::PatchLevel>
+   getCoarserLevel(
+      const Request& request) const;
+
+   std::string d_object_name;
+
+   std::weak_ptr<hier::PatchHierarchy> d_hierarchy;
+
+   std::list<Entry> d_entries;
+
+   int d_num_hits;
+
+   int d_num_resets;
+
+   int d_num_misses;
+
+   std::shared_ptr<tbox::Statistic> d_hits_stat;
+
+   std::shared_ptr<tbox::Statistic> d_resets_stat;
+
+   std::shared_ptr<tbox::Statistic> d_misses_stat;
+};
+
+}
+}
+
+#endif
@@ -212,6 +212,7 @@ public:
    ///      getRefineOpStencilWidth(),
    ///      preprocessRefine()
    ///      postprocessRefine()
+   ///      allowsFusedTimeRefine()
    ///
    ///  are concrete implementations of functions declared in the
    ///  RefinePatchStrategy abstract base class.  Some are trivial
@@ -259,6 +260,12 @@ public:
       NULL_USE(ratio);
    }
 
+   bool
+   allowsFusedTimeRefine() const
+   {
+      return true;
+   }
+
    ///
    ///  The following routines:
    ///
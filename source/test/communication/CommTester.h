@@ -118,6 +118,18 @@ public:
       const std::shared_ptr<hier::BaseGridGeometry> xfer_geom,
       const std::string& operator_name);
 
+   /**
+    * Set the cache through which refine schedules are created.
+    */
+   void
+   setRefineScheduleCache(
+      const std::shared_ptr<xfer::RefineScheduleCache>& cache)
+   {
+      d_fill_source_algorithm.setScheduleCache(cache);
+      d_refine_algorithm.setScheduleCache(cache);
+      d_reset_refine_algorithm.setScheduleCache(cache);
+   }
+
    /**
     * Create communication schedules for refining data to given level.
     */
@@ -202,6 +214,12 @@ public:
    getRefineOpStencilWidth(
       const tbox::Dimension& dim) const;
 
+   bool
+   allowsBatchedRefine() const
+   {
+      return d_batched_hooks;
+   }
+
    void
    preprocessRefine(
       hier::Patch& fine,
@@ -220,6 +238,12 @@ public:
    getCoarsenOpStencilWidth(
       const tbox::Dimension& dim) const;
 
+   bool
+   allowsBatchedCoarsen() const
+   {
+      return d_batched_hooks;
+   }
+
    void
    preprocessCoarsen(
       hier::Patch& coarse,
@@ -281,6 +305,15 @@ public:
    }
 
 private:
+   /*
+    * Create the schedule refining data to the given level with the
+    * given algorithm, as set by the refine option.
+    */
+   std::shared_ptr<xfer::RefineSchedule>
+   createLevelRefineSchedule(
+      xfer::RefineAlgorithm& refine_algorithm,
+      const int level_number);
+
    const tbox::Dimension d_dim;
 
    /*
@@ -306,6 +339,19 @@ private:
     */
    std::string d_refine_option;
 
+   /*
+    * Precision with which refine data is packed into messages, from the
+    * main input pack_precision and pack_error_bound.
+    */
+   tbox::MessageStream::PackPrecision d_pack_precision;
+   double d_pack_error_bound;
+
+   /*
+    * Whether the refine and coarsen hooks may run around batched
+    * operations, from the main input batched_hooks.
+    */
+   bool d_batched_hooks;
+
    /*
     * *hier::Patch hierarchy on which tests occur.
     */
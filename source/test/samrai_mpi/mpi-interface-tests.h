@@ -54,3 +54,14 @@ mpiInterfaceTestAllreduce(
 int
 mpiInterfaceTestParallelPrefixSum(
    int& fail_count);
+
+/*!
+ * @brief Test SAMRAI_MPI::getThreadLevel.
+ *
+ * @param fail_count Increment this count by number of failures.
+ *
+ * @return number of failures found.
+ */
+int
+mpiInterfaceTestThreadLevel(
+   int& fail_count);
@@ -49,6 +49,8 @@ public:
    testPackStream();
    bool
    testDatabaseInterface();
+   bool
+   testColumnStorage();
 
 private:
    static const int DSIZE = 7;
@@ -79,6 +81,13 @@ private:
    _createEmptySparseData();
    hier::Index
    _getRandomIndex();
+   void
+   _fillGrid(
+      std::shared_ptr<SparseDataType> sparse_data,
+      int extent);
+   bool
+   _checkGrid(
+      std::shared_ptr<SparseDataType> sparse_data);
 
    std::shared_ptr<SparseDataType> d_sparse_data;
 